@@ -0,0 +1,190 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Caching allocator for 1d alpaka buffers of one element type on one device.
+// Requests are rounded up to power-of-two size classes, released buffers are kept
+// in a free list per size class and handed out again instead of allocating anew.
+// Reused buffers are already resident, so they also avoid first-touch page faults.
+template<typename TElem, typename TIdx, typename TDev>
+class BufferPool {
+public:
+    using Dim = alpaka::dim::DimInt<1>;
+    using Buf = alpaka::mem::buf::Buf<TDev, TElem, Dim, TIdx>;
+
+    // Buffer handed out by the pool, it is returned to the pool on destruction.
+    // The buffer may be larger than requested, so copies have to use explicit extents.
+    class Lease {
+    public:
+        Lease(Lease && other) noexcept : m_pool(other.m_pool), m_buf(std::move(other.m_buf)), m_sizeClass(other.m_sizeClass)
+        {
+            other.m_pool = nullptr;
+        }
+
+        Lease & operator=(Lease && other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_pool = other.m_pool;
+                m_buf = std::move(other.m_buf);
+                m_sizeClass = other.m_sizeClass;
+                other.m_pool = nullptr;
+            }
+            return *this;
+        }
+
+        Lease(Lease const &) = delete;
+        Lease & operator=(Lease const &) = delete;
+
+        ~Lease()
+        {
+            release();
+        }
+
+        Buf & getBuf()
+        {
+            return m_buf;
+        }
+
+        TElem * getPtr()
+        {
+            return alpaka::mem::view::getPtrNative(m_buf);
+        }
+
+        // Number of elements in the buffer, not less than requested
+        TIdx getCapacity() const
+        {
+            return m_sizeClass;
+        }
+
+    private:
+        friend class BufferPool;
+
+        Lease(BufferPool * pool, Buf buf, TIdx sizeClass) : m_pool(pool), m_buf(std::move(buf)), m_sizeClass(sizeClass)
+        {
+        }
+
+        void release()
+        {
+            if (m_pool)
+                m_pool->giveBack(m_sizeClass, m_buf);
+            m_pool = nullptr;
+        }
+
+        BufferPool * m_pool;
+        Buf m_buf;
+        TIdx m_sizeClass;
+    };
+
+    // Usage statistics of the pool
+    struct Stats {
+        uint64_t numRequests = 0;
+        uint64_t numHits = 0;
+        // Bytes of all buffers allocated by the pool, including cached ones
+        std::size_t allocatedBytes = 0;
+        std::size_t peakAllocatedBytes = 0;
+        // Bytes of the buffers currently handed out
+        std::size_t inUseBytes = 0;
+
+        double getHitRate() const
+        {
+            return numRequests ? static_cast<double>(numHits) / numRequests : 0.0;
+        }
+    };
+
+    // Size classes are powers of two not less than minSizeClass elements
+    explicit BufferPool(TDev const & dev, TIdx minSizeClass = 1024) : m_dev(dev), m_minSizeClass(minSizeClass)
+    {
+    }
+
+    BufferPool(BufferPool const &) = delete;
+    BufferPool & operator=(BufferPool const &) = delete;
+
+    // Get a buffer of at least numElements elements.
+    // Above the largest power of two representable by TIdx, the size class is numElements itself.
+    Lease acquire(TIdx numElements)
+    {
+        uint64_t wideSizeClass = std::max<uint64_t>(static_cast<uint64_t>(m_minSizeClass), 1u);
+        uint64_t const maxSizeClass = static_cast<uint64_t>(std::numeric_limits<TIdx>::max());
+        while (wideSizeClass < static_cast<uint64_t>(numElements) && wideSizeClass <= maxSizeClass / 2)
+            wideSizeClass *= 2;
+        TIdx sizeClass = (wideSizeClass >= static_cast<uint64_t>(numElements) && wideSizeClass <= maxSizeClass)
+            ? static_cast<TIdx>(wideSizeClass)
+            : numElements;
+        std::size_t const bytes = static_cast<std::size_t>(sizeClass) * sizeof(TElem);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.numRequests;
+        m_stats.inUseBytes += bytes;
+        auto & freeList = m_freeLists[sizeClass];
+        if (!freeList.empty())
+        {
+            ++m_stats.numHits;
+            Buf buf = std::move(freeList.back());
+            freeList.pop_back();
+            return Lease{this, std::move(buf), sizeClass};
+        }
+        m_stats.allocatedBytes += bytes;
+        if (m_stats.allocatedBytes > m_stats.peakAllocatedBytes)
+            m_stats.peakAllocatedBytes = m_stats.allocatedBytes;
+        alpaka::vec::Vec<Dim, TIdx> extent{sizeClass};
+        return Lease{this, alpaka::mem::buf::alloc<TElem, TIdx>(m_dev, extent), sizeClass};
+    }
+
+    // Free all cached buffers, buffers handed out are not affected
+    void trim()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto & freeList : m_freeLists)
+        {
+            m_stats.allocatedBytes -= freeList.second.size() * static_cast<std::size_t>(freeList.first) * sizeof(TElem);
+            freeList.second.clear();
+        }
+    }
+
+    Stats getStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+private:
+    void giveBack(TIdx sizeClass, Buf & buf)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.inUseBytes -= static_cast<std::size_t>(sizeClass) * sizeof(TElem);
+        m_freeLists[sizeClass].push_back(std::move(buf));
+    }
+
+    TDev m_dev;
+    TIdx m_minSizeClass;
+    std::map<TIdx, std::vector<Buf>> m_freeLists;
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+};
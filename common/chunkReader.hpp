@@ -0,0 +1,453 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include "hostMemory.hpp"
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Asynchronous readers of file ranges into a fixed set of page-aligned buffers,
+// which keep several reads in flight to use the full bandwidth of the storage device.
+// Reads are submitted for a buffer and complete in any order.
+// Two implementations are provided:
+// - IoUringChunkReader, based on io_uring with the buffers registered with the kernel,
+//   using the raw system calls, so that liburing is not required;
+// - ThreadPoolChunkReader, with threads doing blocking preads, where io_uring is not available.
+// With direct I/O, the page cache is bypassed; then file offsets have to be multiples of
+// chunkReaderAlignment, and reads are extended to multiples of it.
+
+constexpr std::size_t chunkReaderAlignment = 4096;
+
+// Completed read: result is the number of bytes read, or a negative error number
+struct ReadCompletion {
+    uint32_t buffer;
+    int64_t result;
+};
+
+class ChunkReader {
+public:
+    virtual ~ChunkReader()
+    {
+        if (m_fd >= 0)
+            close(m_fd);
+    }
+
+    ChunkReader(ChunkReader const &) = delete;
+    ChunkReader & operator=(ChunkReader const &) = delete;
+
+    virtual char const * getName() const = 0;
+
+    // Start reading at least bytes bytes at offset into the buffer, return false on failure.
+    // Fewer bytes are read only at the end of the file.
+    virtual bool submit(uint32_t buffer, uint64_t offset, std::size_t bytes) = 0;
+
+    // Wait for the next completed read
+    virtual ReadCompletion wait() = 0;
+
+    void * getBuffer(uint32_t buffer) const
+    {
+        return m_buffers[buffer].get<void>();
+    }
+
+    uint32_t getNumBuffers() const
+    {
+        return static_cast<uint32_t>(m_buffers.size());
+    }
+
+    bool isDirect() const
+    {
+        return m_isDirect;
+    }
+
+protected:
+    ChunkReader() = default;
+
+    // Open the file and allocate the buffers, return false on failure
+    bool init(std::string const & path, uint32_t numBuffers, std::size_t bufferBytes, bool isDirect)
+    {
+        m_isDirect = isDirect;
+        m_fd = open(path.c_str(), O_RDONLY | (isDirect ? O_DIRECT : 0));
+        if (m_fd < 0)
+            return false;
+        m_bufferBytes = getReadBytes(bufferBytes);
+        for (uint32_t buffer = 0; buffer < numBuffers; buffer++)
+        {
+            m_buffers.push_back(HostMemory::allocate(m_bufferBytes, PageKind::Regular));
+            if (!m_buffers.back())
+                return false;
+        }
+        return true;
+    }
+
+    // Number of bytes to read for a request of bytes bytes
+    std::size_t getReadBytes(std::size_t bytes) const
+    {
+        if (!m_isDirect)
+            return bytes;
+        return (bytes + chunkReaderAlignment - 1) / chunkReaderAlignment * chunkReaderAlignment;
+    }
+
+    bool isValidRequest(uint32_t buffer, uint64_t offset, std::size_t bytes) const
+    {
+        return buffer < m_buffers.size() && getReadBytes(bytes) <= m_bufferBytes
+            && (!m_isDirect || offset % chunkReaderAlignment == 0);
+    }
+
+    int m_fd = -1;
+    bool m_isDirect = false;
+    std::size_t m_bufferBytes = 0;
+    std::vector<HostMemory> m_buffers;
+};
+
+// Reader based on io_uring, with one submission queue entry per read
+class IoUringChunkReader : public ChunkReader {
+public:
+    ~IoUringChunkReader() override
+    {
+        if (m_sqes)
+            munmap(m_sqes, m_sqesBytes);
+        if (m_cqRing && m_cqRing != m_sqRing)
+            munmap(m_cqRing, m_cqRingBytes);
+        if (m_sqRing)
+            munmap(m_sqRing, m_sqRingBytes);
+        if (m_ringFd >= 0)
+            close(m_ringFd);
+    }
+
+    // Returns nullptr if io_uring is not available, e.g. with old kernels or when blocked by seccomp
+    static std::unique_ptr<IoUringChunkReader> create(std::string const & path, uint32_t numBuffers,
+        std::size_t bufferBytes, bool isDirect)
+    {
+        std::unique_ptr<IoUringChunkReader> reader(new IoUringChunkReader());
+        if (!reader->init(path, numBuffers, bufferBytes, isDirect) || !reader->setupRing(numBuffers))
+            return nullptr;
+        reader->registerBuffers();
+        return reader;
+    }
+
+    char const * getName() const override
+    {
+        return m_isRegistered ? "io_uring with registered buffers" : "io_uring";
+    }
+
+    bool submit(uint32_t buffer, uint64_t offset, std::size_t bytes) override
+    {
+        if (!isValidRequest(buffer, offset, bytes))
+            return false;
+        m_requests[buffer] = Request{offset, bytes, 0};
+        return submitRead(buffer);
+    }
+
+    ReadCompletion wait() override
+    {
+        while (true)
+        {
+            io_uring_cqe cqe;
+            if (!popCompletion(cqe))
+            {
+                long result = syscall(__NR_io_uring_enter, m_ringFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+                if (result < 0 && errno != EINTR)
+                    return {0, -errno};
+                continue;
+            }
+            uint32_t buffer = static_cast<uint32_t>(cqe.user_data);
+            Request & request = m_requests[buffer];
+            // Retry reads the kernel could not start, e.g. with direct I/O on pages being written back
+            if (cqe.res == -EAGAIN)
+            {
+                if (!submitRead(buffer))
+                    return {buffer, -EIO};
+                continue;
+            }
+            if (cqe.res < 0)
+                return {buffer, cqe.res};
+            request.doneBytes += static_cast<std::size_t>(cqe.res);
+            // Continue short reads, unless the end of the file is reached
+            // or direct I/O cannot continue at an unaligned offset
+            bool const canContinue = !m_isDirect || request.doneBytes % chunkReaderAlignment == 0;
+            if (cqe.res > 0 && request.doneBytes < request.bytes && canContinue)
+            {
+                if (!submitRead(buffer))
+                    return {buffer, -EIO};
+                continue;
+            }
+            return {buffer, static_cast<int64_t>(request.doneBytes)};
+        }
+    }
+
+private:
+    struct Request {
+        uint64_t offset;
+        std::size_t bytes;
+        std::size_t doneBytes;
+    };
+
+    IoUringChunkReader() = default;
+
+    bool setupRing(uint32_t numEntries)
+    {
+        io_uring_params params{};
+        long fd = syscall(__NR_io_uring_setup, numEntries, &params);
+        if (fd < 0)
+            return false;
+        m_ringFd = static_cast<int>(fd);
+        m_sqRingBytes = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        m_cqRingBytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        // With a single mapping, both rings share it
+        bool const isSingleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (isSingleMmap)
+            m_sqRingBytes = m_cqRingBytes = std::max(m_sqRingBytes, m_cqRingBytes);
+        m_sqRing = mapRing(m_sqRingBytes, IORING_OFF_SQ_RING);
+        if (!m_sqRing)
+            return false;
+        m_cqRing = isSingleMmap ? m_sqRing : mapRing(m_cqRingBytes, IORING_OFF_CQ_RING);
+        if (!m_cqRing)
+            return false;
+        m_sqesBytes = params.sq_entries * sizeof(io_uring_sqe);
+        m_sqes = static_cast<io_uring_sqe *>(mapRing(m_sqesBytes, IORING_OFF_SQES));
+        if (!m_sqes)
+            return false;
+
+        auto * sq = static_cast<char *>(m_sqRing);
+        m_sqTail = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+        m_sqMask = *reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+        m_sqArray = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+        auto * cq = static_cast<char *>(m_cqRing);
+        m_cqHead = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+        m_cqTail = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+        m_cqMask = *reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        m_requests.resize(m_buffers.size());
+        return true;
+    }
+
+    void * mapRing(std::size_t bytes, uint64_t offset)
+    {
+        void * ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+            static_cast<off_t>(offset));
+        return (ptr == MAP_FAILED) ? nullptr : ptr;
+    }
+
+    // Registered buffers are pinned once, instead of on every read.
+    // Registration may fail due to RLIMIT_MEMLOCK, then plain reads are used.
+    void registerBuffers()
+    {
+        std::vector<iovec> iovecs;
+        for (auto const & buffer : m_buffers)
+            iovecs.push_back(iovec{buffer.get<void>(), m_bufferBytes});
+        m_isRegistered = syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_BUFFERS, iovecs.data(),
+            static_cast<unsigned>(iovecs.size())) == 0;
+    }
+
+    // Submit the remaining part of the request of the buffer
+    bool submitRead(uint32_t buffer)
+    {
+        Request const & request = m_requests[buffer];
+        // Only the application writes the tail of the submission queue
+        uint32_t const tail = *m_sqTail;
+        uint32_t const index = tail & m_sqMask;
+        io_uring_sqe & sqe = m_sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = m_isRegistered ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe.fd = m_fd;
+        sqe.addr = reinterpret_cast<uint64_t>(m_buffers[buffer].get<char>() + request.doneBytes);
+        sqe.len = static_cast<uint32_t>(getReadBytes(request.bytes) - request.doneBytes);
+        sqe.off = request.offset + request.doneBytes;
+        sqe.buf_index = static_cast<uint16_t>(buffer);
+        sqe.user_data = buffer;
+        m_sqArray[index] = index;
+        __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+        // The kernel may be temporarily out of resources to take the entry
+        long result;
+        do
+            result = syscall(__NR_io_uring_enter, m_ringFd, 1, 0, 0, nullptr, 0);
+        while (result < 0 && (errno == EINTR || errno == EAGAIN));
+        return result == 1;
+    }
+
+    bool popCompletion(io_uring_cqe & cqe)
+    {
+        uint32_t const head = *m_cqHead;
+        if (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE))
+            return false;
+        cqe = m_cqes[head & m_cqMask];
+        __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    int m_ringFd = -1;
+    bool m_isRegistered = false;
+    void * m_sqRing = nullptr;
+    void * m_cqRing = nullptr;
+    io_uring_sqe * m_sqes = nullptr;
+    std::size_t m_sqRingBytes = 0;
+    std::size_t m_cqRingBytes = 0;
+    std::size_t m_sqesBytes = 0;
+    uint32_t * m_sqTail = nullptr;
+    uint32_t m_sqMask = 0;
+    uint32_t * m_sqArray = nullptr;
+    uint32_t * m_cqHead = nullptr;
+    uint32_t * m_cqTail = nullptr;
+    uint32_t m_cqMask = 0;
+    io_uring_cqe * m_cqes = nullptr;
+    std::vector<Request> m_requests;
+};
+
+// Reader with a pool of threads doing blocking preads
+class ThreadPoolChunkReader : public ChunkReader {
+public:
+    ~ThreadPoolChunkReader() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_isStopping = true;
+        }
+        m_requestAdded.notify_all();
+        for (auto & thread : m_threads)
+            thread.join();
+    }
+
+    static std::unique_ptr<ThreadPoolChunkReader> create(std::string const & path, uint32_t numBuffers,
+        std::size_t bufferBytes, bool isDirect, uint32_t numThreads)
+    {
+        std::unique_ptr<ThreadPoolChunkReader> reader(new ThreadPoolChunkReader());
+        if (!reader->init(path, numBuffers, bufferBytes, isDirect))
+            return nullptr;
+        for (uint32_t thread = 0; thread < std::max(numThreads, 1u); thread++)
+            reader->m_threads.emplace_back([&reader = *reader]() { reader.work(); });
+        return reader;
+    }
+
+    char const * getName() const override
+    {
+        return "pread thread pool";
+    }
+
+    bool submit(uint32_t buffer, uint64_t offset, std::size_t bytes) override
+    {
+        if (!isValidRequest(buffer, offset, bytes))
+            return false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.push_back(Request{buffer, offset, bytes});
+        }
+        m_requestAdded.notify_one();
+        return true;
+    }
+
+    ReadCompletion wait() override
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_completionAdded.wait(lock, [this]() { return !m_completions.empty(); });
+        ReadCompletion completion = m_completions.front();
+        m_completions.pop_front();
+        return completion;
+    }
+
+private:
+    struct Request {
+        uint32_t buffer;
+        uint64_t offset;
+        std::size_t bytes;
+    };
+
+    ThreadPoolChunkReader() = default;
+
+    void work()
+    {
+        while (true)
+        {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_requestAdded.wait(lock, [this]() { return m_isStopping || !m_requests.empty(); });
+                if (m_requests.empty())
+                    return;
+                request = m_requests.front();
+                m_requests.pop_front();
+            }
+            ReadCompletion completion{request.buffer, read(request)};
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_completions.push_back(completion);
+            }
+            m_completionAdded.notify_one();
+        }
+    }
+
+    int64_t read(Request const & request) const
+    {
+        auto * ptr = m_buffers[request.buffer].get<char>();
+        std::size_t const readBytes = getReadBytes(request.bytes);
+        std::size_t doneBytes = 0;
+        while (doneBytes < request.bytes)
+        {
+            ssize_t result = pread(m_fd, ptr + doneBytes, readBytes - doneBytes,
+                static_cast<off_t>(request.offset + doneBytes));
+            if (result < 0 && errno == EINTR)
+                continue;
+            if (result < 0)
+                return -errno;
+            if (result == 0)
+                break;
+            doneBytes += static_cast<std::size_t>(result);
+        }
+        return static_cast<int64_t>(doneBytes);
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_requestAdded;
+    std::condition_variable m_completionAdded;
+    std::deque<Request> m_requests;
+    std::deque<ReadCompletion> m_completions;
+    std::vector<std::thread> m_threads;
+    bool m_isStopping = false;
+};
+
+// Create an io_uring reader, or a thread pool reader if io_uring is not available or not requested.
+// Returns nullptr if the file cannot be opened, e.g. when direct I/O is not supported by the file system.
+inline std::unique_ptr<ChunkReader> createChunkReader(std::string const & path, uint32_t numBuffers,
+    std::size_t bufferBytes, bool isDirect, bool useIoUring)
+{
+    if (useIoUring)
+    {
+        auto reader = IoUringChunkReader::create(path, numBuffers, bufferBytes, isDirect);
+        if (reader)
+            return std::unique_ptr<ChunkReader>(std::move(reader));
+    }
+    return std::unique_ptr<ChunkReader>(ThreadPoolChunkReader::create(path, numBuffers, bufferBytes, isDirect,
+        numBuffers));
+}
@@ -0,0 +1,202 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+// Logging from kernels without printf.
+// printf from many threads serializes on the lock of stdout and interleaves the output,
+// so that it dominates the run time of the kernel it is meant to observe.
+// Instead, threads append fixed-size binary records to a ring buffer in device memory,
+// each reserving its slot with an atomic fetch-add, and the host formats the records
+// after the kernel. The ring is not wrapped over during a kernel: records which do not fit
+// between the last drain and the capacity are dropped and counted.
+
+// Maximum number of arguments of a record
+constexpr uint32_t maxLogArgs = 4;
+
+// Whether all argument types are integers of at most 32 bits, which a record stores without loss
+template<typename... Args>
+struct AreLogArgs : std::true_type {
+};
+
+template<typename Arg, typename... Args>
+struct AreLogArgs<Arg, Args...>
+    : std::integral_constant<bool,
+          std::is_integral<Arg>::value && sizeof(Arg) <= sizeof(uint32_t) && AreLogArgs<Args...>::value> {
+};
+
+// Record of a single log call, the format id indexes the format strings given to drain
+struct LogRecord {
+    uint32_t formatId;
+    uint32_t gridBlockIdx;
+    uint32_t blockThreadIdx;
+    uint32_t numArgs;
+    uint32_t args[maxLogArgs];
+};
+
+// Handle of the ring buffer passed to kernels by value
+struct DeviceLog {
+    LogRecord * records;
+    uint32_t * head;
+    // Position of the first record not yet drained
+    uint32_t tail;
+    // Number of records, a power of two
+    uint32_t capacity;
+
+    // Append a record with the indices of the calling thread in the first dimension,
+    // return false if the ring is full and the record is dropped.
+    // Arguments are integers of at most 32 bits, stored as the bits of a uint32_t, so the
+    // format string may only use %u, %x or %X for them, or %d for signed arguments.
+    template<typename Acc, typename... Args>
+    ALPAKA_FN_ACC bool append(Acc const & acc, uint32_t formatId, Args... args) const
+    {
+        using namespace alpaka;
+        static_assert(sizeof...(Args) <= maxLogArgs, "Too many arguments for a log record");
+        static_assert(AreLogArgs<Args...>::value, "Log arguments must be integers of at most 32 bits");
+        uint32_t position = atomic::atomicOp<atomic::op::Add>(acc, head, 1u);
+        // Unsigned arithmetic, so that the positions may wrap around
+        if (position - tail >= capacity)
+            return false;
+        LogRecord & record = records[position & (capacity - 1)];
+        record.formatId = formatId;
+        record.gridBlockIdx = static_cast<uint32_t>(idx::getIdx<Grid, Blocks>(acc)[0]);
+        record.blockThreadIdx = static_cast<uint32_t>(idx::getIdx<Block, Threads>(acc)[0]);
+        record.numArgs = sizeof...(Args);
+        uint32_t const values[] = {static_cast<uint32_t>(args)..., 0u};
+        for (uint32_t i = 0; i < sizeof...(Args); i++)
+            record.args[i] = values[i];
+        return true;
+    }
+};
+
+// Result of draining the log
+struct LogDrainResult {
+    uint32_t numRecords;
+    uint32_t numDropped;
+};
+
+// Owner of the ring buffer on a device, which drains and formats the records on the host
+template<typename TDev, typename TIdx>
+class DeviceLogBuffer {
+public:
+    using Dim = alpaka::dim::DimInt<1>;
+
+    // Capacity in records, rounded up to a power of two, at most 2^31
+    DeviceLogBuffer(TDev const & device, uint32_t capacity)
+        : m_capacity(roundUpToPowerOfTwo(capacity)), m_tail(0),
+          m_recordsBuffer(alpaka::mem::buf::alloc<LogRecord, TIdx>(device, alpaka::vec::Vec<Dim, TIdx>{m_capacity})),
+          m_headBuffer(alpaka::mem::buf::alloc<uint32_t, TIdx>(device, alpaka::vec::Vec<Dim, TIdx>{1u})),
+          m_recordsBufferHost(alpaka::mem::buf::alloc<LogRecord, TIdx>(
+              alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u), alpaka::vec::Vec<Dim, TIdx>{m_capacity})),
+          m_headBufferHost(alpaka::mem::buf::alloc<uint32_t, TIdx>(
+              alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u), alpaka::vec::Vec<Dim, TIdx>{1u}))
+    {
+    }
+
+    // Reset the head on the device, before the first kernel using the log
+    template<typename TQueue>
+    void clear(TQueue & queue)
+    {
+        alpaka::mem::view::set(queue, m_headBuffer, 0u, alpaka::vec::Vec<Dim, TIdx>{1u});
+        m_tail = 0;
+    }
+
+    // Handle for the next kernels, valid until the next drain
+    DeviceLog getDeviceLog()
+    {
+        return DeviceLog{alpaka::mem::view::getPtrNative(m_recordsBuffer), alpaka::mem::view::getPtrNative(m_headBuffer),
+            m_tail, m_capacity};
+    }
+
+    // Wait for the queue, then format the records appended since the last drain, one line each.
+    // Sorted, the records are in the order of blocks and threads, and the records of a thread
+    // in the order of appending, unsorted all records are in the order of appending.
+    template<typename TQueue>
+    LogDrainResult drain(TQueue & queue, std::vector<char const *> const & formats, bool isSorted, std::ostream & out)
+    {
+        using namespace alpaka;
+        vec::Vec<Dim, TIdx> headExtent{1u};
+        vec::Vec<Dim, TIdx> recordsExtent{m_capacity};
+        mem::view::copy(queue, m_headBufferHost, m_headBuffer, headExtent);
+        mem::view::copy(queue, m_recordsBufferHost, m_recordsBuffer, recordsExtent);
+        alpaka::wait::wait(queue);
+        uint32_t head = *mem::view::getPtrNative(m_headBufferHost);
+        uint32_t numAppended = head - m_tail;
+        LogDrainResult result;
+        result.numRecords = std::min(numAppended, m_capacity);
+        result.numDropped = numAppended - result.numRecords;
+
+        LogRecord const * records = mem::view::getPtrNative(m_recordsBufferHost);
+        std::vector<LogRecord> drained(result.numRecords);
+        for (uint32_t i = 0; i < result.numRecords; i++)
+            drained[i] = records[(m_tail + i) & (m_capacity - 1)];
+        m_tail = head;
+        if (isSorted)
+            std::stable_sort(drained.begin(), drained.end(), [](LogRecord const & a, LogRecord const & b) {
+                return (a.gridBlockIdx < b.gridBlockIdx)
+                    || (a.gridBlockIdx == b.gridBlockIdx && a.blockThreadIdx < b.blockThreadIdx);
+            });
+
+        char line[256];
+        for (auto const & record : drained)
+        {
+            if (record.formatId < formats.size())
+                std::snprintf(line, sizeof(line), formats[record.formatId], record.args[0], record.args[1],
+                    record.args[2], record.args[3]);
+            else
+                std::snprintf(line, sizeof(line), "unknown format %u", record.formatId);
+            out << "[block " << record.gridBlockIdx << ", thread " << record.blockThreadIdx << "] " << line << "\n";
+        }
+        return result;
+    }
+
+    uint32_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+    static uint32_t roundUpToPowerOfTwo(uint32_t value)
+    {
+        uint32_t result = 1;
+        while (result < value && result < (1u << 31))
+            result *= 2;
+        return result;
+    }
+
+    using BufRecords = alpaka::mem::buf::Buf<TDev, LogRecord, Dim, TIdx>;
+    using BufHead = alpaka::mem::buf::Buf<TDev, uint32_t, Dim, TIdx>;
+    using BufRecordsHost = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, LogRecord, Dim, TIdx>;
+    using BufHeadHost = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, uint32_t, Dim, TIdx>;
+
+    uint32_t m_capacity;
+    uint32_t m_tail;
+    BufRecords m_recordsBuffer;
+    BufHead m_headBuffer;
+    BufRecordsHost m_recordsBufferHost;
+    BufHeadHost m_headBufferHost;
+};
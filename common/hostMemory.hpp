@@ -0,0 +1,283 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Host memory mapped directly from the OS, with control over the page size.
+// Unlike alpaka buffers, it can be backed by huge pages and is not touched on allocation.
+// For CPU accelerators it can be used as device memory as well, by wrapping it into
+// an alpaka::mem::view::ViewPlainPtr.
+
+// Kinds of pages backing the memory
+enum class PageKind {
+    // Regular pages, transparent huge pages are disabled for the mapping
+    Regular,
+    // Transparent huge pages requested with madvise, the kernel may still use regular pages
+    TransparentHuge,
+    // Explicit 2 MiB huge pages from hugetlbfs, they have to be reserved by the administrator
+    HugeTlb2M,
+    // Explicit 1 GiB huge pages from hugetlbfs, they have to be reserved by the administrator
+    HugeTlb1G
+};
+
+inline char const * getPageKindName(PageKind kind)
+{
+    switch (kind)
+    {
+    case PageKind::Regular:
+        return "regular";
+    case PageKind::TransparentHuge:
+        return "transparent huge";
+    case PageKind::HugeTlb2M:
+        return "hugetlbfs 2 MiB";
+    case PageKind::HugeTlb1G:
+        return "hugetlbfs 1 GiB";
+    }
+    return "unknown";
+}
+
+// NUMA nodes with memory, parsed from a list like "0-1,3" in sysfs.
+// Returns a single node 0 on systems without NUMA information.
+inline std::vector<int> getNumaNodesWithMemory()
+{
+    std::vector<int> nodes;
+    std::ifstream file("/sys/devices/system/node/has_memory");
+    std::string range;
+    while (std::getline(file, range, ','))
+    {
+        auto const dash = range.find('-');
+        int const first = std::stoi(range.substr(0, dash));
+        int const last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+        for (int node = first; node <= last; node++)
+            nodes.push_back(node);
+    }
+    if (nodes.empty())
+        nodes.push_back(0);
+    return nodes;
+}
+
+// Whether transparent huge pages can be requested with madvise, i.e. they are not disabled system-wide
+inline bool isTransparentHugePageEnabled()
+{
+    std::ifstream file("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string setting;
+    if (!std::getline(file, setting))
+        return false;
+    return setting.find("[never]") == std::string::npos;
+}
+
+// Owning handle of a memory mapping
+class HostMemory {
+public:
+    HostMemory() = default;
+
+    HostMemory(HostMemory && other) noexcept
+        : m_ptr(other.m_ptr), m_mappedPtr(other.m_mappedPtr), m_bytes(other.m_bytes),
+          m_mappedBytes(other.m_mappedBytes), m_kind(other.m_kind)
+    {
+        other.m_ptr = nullptr;
+        other.m_mappedPtr = nullptr;
+    }
+
+    HostMemory & operator=(HostMemory && other) noexcept
+    {
+        std::swap(m_ptr, other.m_ptr);
+        std::swap(m_mappedPtr, other.m_mappedPtr);
+        std::swap(m_bytes, other.m_bytes);
+        std::swap(m_mappedBytes, other.m_mappedBytes);
+        std::swap(m_kind, other.m_kind);
+        return *this;
+    }
+
+    HostMemory(HostMemory const &) = delete;
+    HostMemory & operator=(HostMemory const &) = delete;
+
+    ~HostMemory()
+    {
+        if (m_mappedPtr)
+            munmap(m_mappedPtr, m_mappedBytes);
+    }
+
+    // Allocate at least bytes bytes backed by the requested kind of pages.
+    // When they are not available, fall back to the next smaller kind down to regular pages,
+    // getKind() tells the kind actually used.
+    // The memory is not touched, so physical pages are only assigned on first touch.
+    // Returns an empty handle if even regular pages cannot be mapped.
+    static HostMemory allocate(std::size_t bytes, PageKind kind)
+    {
+        HostMemory memory;
+        switch (kind)
+        {
+        case PageKind::HugeTlb1G:
+            if (memory.mapHugeTlb(bytes, std::size_t{1} << 30, 30))
+                return memory;
+            // fall through
+        case PageKind::HugeTlb2M:
+            if (memory.mapHugeTlb(bytes, std::size_t{1} << 21, 21))
+                return memory;
+            // fall through
+        case PageKind::TransparentHuge:
+            if (memory.mapTransparentHuge(bytes))
+                return memory;
+            // fall through
+        case PageKind::Regular:
+            memory.mapRegular(bytes);
+        }
+        return memory;
+    }
+
+    template<typename T>
+    T * get() const
+    {
+        return static_cast<T *>(m_ptr);
+    }
+
+    // Requested size in bytes
+    std::size_t getBytes() const
+    {
+        return m_bytes;
+    }
+
+    PageKind getKind() const
+    {
+        return m_kind;
+    }
+
+    // Interleave the pages round-robin over all NUMA nodes with memory.
+    // Has to be called before the memory is touched, returns false if not supported.
+    bool interleave() const
+    {
+        unsigned long nodeMask[16] = {};
+        unsigned long const bitsPerWord = 8 * sizeof(unsigned long);
+        for (int node : getNumaNodesWithMemory())
+            if (static_cast<unsigned long>(node) < 16 * bitsPerWord)
+                nodeMask[node / bitsPerWord] |= 1ul << (node % bitsPerWord);
+        return syscall(SYS_mbind, m_ptr, m_bytes, MPOL_INTERLEAVE, nodeMask, 16 * bitsPerWord, 0) == 0;
+    }
+
+    // Place all pages on the given NUMA node.
+    // Has to be called before the memory is touched, returns false if not supported.
+    bool bindToNode(int node) const
+    {
+        unsigned long nodeMask[16] = {};
+        unsigned long const bitsPerWord = 8 * sizeof(unsigned long);
+        if (node < 0 || static_cast<unsigned long>(node) >= 16 * bitsPerWord)
+            return false;
+        nodeMask[node / bitsPerWord] |= 1ul << (node % bitsPerWord);
+        return syscall(SYS_mbind, m_ptr, m_bytes, MPOL_BIND, nodeMask, 16 * bitsPerWord, 0) == 0;
+    }
+
+    explicit operator bool() const
+    {
+        return m_ptr != nullptr;
+    }
+
+private:
+    static std::size_t roundUp(std::size_t bytes, std::size_t alignment)
+    {
+        return (bytes + alignment - 1) / alignment * alignment;
+    }
+
+    bool map(std::size_t bytes, int flags)
+    {
+        void * ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+        if (ptr == MAP_FAILED)
+            return false;
+        m_ptr = m_mappedPtr = ptr;
+        m_mappedBytes = bytes;
+        m_bytes = bytes;
+        return true;
+    }
+
+    bool mapHugeTlb(std::size_t bytes, std::size_t pageBytes, int pageShift)
+    {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+        if (!map(roundUp(bytes, pageBytes), MAP_HUGETLB | (pageShift << MAP_HUGE_SHIFT)))
+            return false;
+        m_bytes = bytes;
+        m_kind = (pageShift == 30) ? PageKind::HugeTlb1G : PageKind::HugeTlb2M;
+        return true;
+#else
+        (void) bytes;
+        (void) pageBytes;
+        (void) pageShift;
+        return false;
+#endif
+    }
+
+    bool mapTransparentHuge(std::size_t bytes)
+    {
+#if defined(MADV_HUGEPAGE)
+        // Transparent huge pages are only used for 2 MiB aligned ranges,
+        // so over-allocate and use an aligned part of the mapping
+        std::size_t const hugePageBytes = std::size_t{1} << 21;
+        if (!isTransparentHugePageEnabled() || !map(roundUp(bytes, hugePageBytes) + hugePageBytes, 0))
+            return false;
+        auto const address = reinterpret_cast<std::uintptr_t>(m_mappedPtr);
+        m_ptr = reinterpret_cast<void *>(roundUp(address, hugePageBytes));
+        m_bytes = bytes;
+        // Fails e.g. with EINVAL on kernels without transparent huge page support
+        if (madvise(m_ptr, roundUp(bytes, hugePageBytes), MADV_HUGEPAGE) != 0)
+        {
+            unmap();
+            return false;
+        }
+        m_kind = PageKind::TransparentHuge;
+        return true;
+#else
+        (void) bytes;
+        return false;
+#endif
+    }
+
+    void unmap()
+    {
+        munmap(m_mappedPtr, m_mappedBytes);
+        m_ptr = m_mappedPtr = nullptr;
+        m_bytes = m_mappedBytes = 0;
+    }
+
+    bool mapRegular(std::size_t bytes)
+    {
+        if (!map(bytes, 0))
+            return false;
+#if defined(MADV_NOHUGEPAGE)
+        // Transparent huge pages may be enabled system-wide, opt out of them
+        madvise(m_ptr, bytes, MADV_NOHUGEPAGE);
+#endif
+        m_kind = PageKind::Regular;
+        return true;
+    }
+
+    void * m_ptr = nullptr;
+    void * m_mappedPtr = nullptr;
+    std::size_t m_bytes = 0;
+    std::size_t m_mappedBytes = 0;
+    PageKind m_kind = PageKind::Regular;
+};
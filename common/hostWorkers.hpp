@@ -0,0 +1,37 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <sched.h>
+
+#include <cstdint>
+#include <thread>
+
+// Number of host threads to size the grid of a CPU accelerator from.
+// alpaka reports a single multiprocessor for CPU devices, so it cannot be taken from the device properties.
+// Counts the CPUs in the affinity mask of the calling thread, which honors taskset, cgroup cpusets and
+// pinning of the process, and falls back to the number of hardware threads when the mask is not available.
+inline uint32_t getNumHostWorkers()
+{
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0 && CPU_COUNT(&mask) > 0)
+        return static_cast<uint32_t>(CPU_COUNT(&mask));
+    unsigned const numHardwareThreads = std::thread::hardware_concurrency();
+    return (numHardwareThreads > 0) ? numHardwareThreads : 1u;
+}
@@ -0,0 +1,282 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Pipeline of stages running concurrently, each on its own host thread.
+// The items passed between the stages are chunk handles: indices of a fixed set of slots,
+// whose data is owned by the application. The stages are connected by bounded lock-free
+// single-producer single-consumer rings, and the slots circulate through them:
+// the first stage takes a free slot and fills it, the following stages process it in turn,
+// and after the last stage it is free again. So the number of slots bounds the chunks in flight,
+// and a slow stage makes the stages before it wait, which is the backpressure of the pipeline.
+// For each stage, the time processing and the time stalled on input and output are measured,
+// the stage with the highest utilization limits the throughput.
+
+constexpr std::size_t pipelineCacheLineBytes = 64;
+
+// Handle passed on after the last chunk
+constexpr uint32_t pipelineEndOfStream = std::numeric_limits<uint32_t>::max();
+
+// Bounded ring for exactly one producer and one consumer thread, without locks.
+// The capacity is rounded up to a power of two.
+template<typename T>
+class SpscRing {
+public:
+    explicit SpscRing(uint32_t capacity)
+    {
+        uint32_t size = 1;
+        while (size < capacity)
+            size *= 2;
+        m_items.resize(size);
+        m_mask = size - 1;
+    }
+
+    SpscRing(SpscRing const &) = delete;
+    SpscRing & operator=(SpscRing const &) = delete;
+
+    uint32_t getCapacity() const
+    {
+        return static_cast<uint32_t>(m_items.size());
+    }
+
+    // Called by the producer only, returns false if the ring is full
+    bool tryPush(T const & item)
+    {
+        uint64_t const tail = m_producer.index.load(std::memory_order_relaxed);
+        if (tail - m_producer.cachedOtherIndex == m_items.size())
+        {
+            m_producer.cachedOtherIndex = m_consumer.index.load(std::memory_order_acquire);
+            if (tail - m_producer.cachedOtherIndex == m_items.size())
+                return false;
+        }
+        m_items[tail & m_mask] = item;
+        m_producer.index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Called by the consumer only, returns false if the ring is empty
+    bool tryPop(T & item)
+    {
+        uint64_t const head = m_consumer.index.load(std::memory_order_relaxed);
+        if (head == m_consumer.cachedOtherIndex)
+        {
+            m_consumer.cachedOtherIndex = m_producer.index.load(std::memory_order_acquire);
+            if (head == m_consumer.cachedOtherIndex)
+                return false;
+        }
+        item = m_items[head & m_mask];
+        m_consumer.index.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    // Index of one side of the ring, next to the copy of the index of the other side it has seen last,
+    // so the other index is only read when the ring seems full or empty.
+    // The padding keeps the indices of both sides on different cache lines,
+    // without over-aligned allocation, which needs C++17.
+    struct Side {
+        std::atomic<uint64_t> index{0};
+        uint64_t cachedOtherIndex = 0;
+        char padding[pipelineCacheLineBytes];
+    };
+
+    Side m_producer;
+    Side m_consumer;
+    std::vector<T> m_items;
+    uint64_t m_mask = 0;
+};
+
+// Time measurements of a stage
+struct StageStats {
+    std::string name;
+    uint64_t numItems = 0;
+    double busySeconds = 0.0;
+    // Waiting for a chunk from the previous stage, or for a free slot in the first stage
+    double inputStallSeconds = 0.0;
+    // Waiting for room in the ring to the next stage
+    double outputStallSeconds = 0.0;
+
+    double getUtilization(double wallSeconds) const
+    {
+        return (wallSeconds > 0.0) ? busySeconds / wallSeconds : 0.0;
+    }
+};
+
+class Pipeline {
+public:
+    // Fill the slot with the next chunk, return false at the end of the input
+    using SourceFunction = std::function<bool(uint32_t slot)>;
+    // Process the chunk in the slot
+    using StageFunction = std::function<void(uint32_t slot)>;
+
+    // The rings between the stages hold up to ringCapacity handles
+    Pipeline(uint32_t numSlots, uint32_t ringCapacity)
+        : m_numSlots(numSlots), m_ringCapacity(ringCapacity), m_stats(1)
+    {
+    }
+
+    Pipeline(Pipeline const &) = delete;
+    Pipeline & operator=(Pipeline const &) = delete;
+
+    void setSource(std::string const & name, SourceFunction source)
+    {
+        m_source = std::move(source);
+        m_stats.front().name = name;
+    }
+
+    // Add a stage after the stages added so far
+    void addStage(std::string const & name, StageFunction stage)
+    {
+        m_stages.push_back(std::move(stage));
+        m_stats.push_back(StageStats{});
+        m_stats.back().name = name;
+    }
+
+    // Run all stages until the source has no more chunks and all chunks passed all stages,
+    // return the wall time in seconds
+    double run()
+    {
+        uint32_t const numStages = static_cast<uint32_t>(m_stats.size());
+        for (auto & stats : m_stats)
+            stats = StageStats{stats.name};
+        // The ring of free slots never fills up, as it can hold all of them
+        m_freeSlots.reset(new SpscRing<uint32_t>(m_numSlots));
+        for (uint32_t slot = 0; slot < m_numSlots; slot++)
+            m_freeSlots->tryPush(slot);
+        m_rings.clear();
+        for (uint32_t stage = 0; stage + 1 < numStages; stage++)
+            m_rings.emplace_back(new SpscRing<uint32_t>(m_ringCapacity));
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        threads.emplace_back([this]() { runSource(); });
+        for (uint32_t stage = 1; stage < numStages; stage++)
+            threads.emplace_back([this, stage]() { runStage(stage); });
+        for (auto & thread : threads)
+            thread.join();
+        m_wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return m_wallSeconds;
+    }
+
+    // Stats of the source and the stages in pipeline order, valid after run()
+    std::vector<StageStats> const & getStats() const
+    {
+        return m_stats;
+    }
+
+    double getWallSeconds() const
+    {
+        return m_wallSeconds;
+    }
+
+    // Index of the stage with the highest utilization, which limits the throughput
+    std::size_t getBottleneck() const
+    {
+        std::size_t bottleneck = 0;
+        for (std::size_t stage = 1; stage < m_stats.size(); stage++)
+            if (m_stats[stage].busySeconds > m_stats[bottleneck].busySeconds)
+                bottleneck = stage;
+        return bottleneck;
+    }
+
+private:
+    // Wait until tryOperation succeeds, spinning first and then yielding the core to other threads.
+    // Returns the time waited in seconds.
+    template<typename TOperation>
+    static double waitFor(TOperation && tryOperation)
+    {
+        if (tryOperation())
+            return 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t spin = 0; !tryOperation(); spin++)
+            if (spin >= 64)
+                std::this_thread::yield();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Ring the stage pushes its chunks into, after the last stage the slots are free again
+    SpscRing<uint32_t> & getOutput(uint32_t stage)
+    {
+        return (stage < m_rings.size()) ? *m_rings[stage] : *m_freeSlots;
+    }
+
+    void runSource()
+    {
+        StageStats & stats = m_stats.front();
+        SpscRing<uint32_t> & output = getOutput(0);
+        while (true)
+        {
+            uint32_t slot;
+            stats.inputStallSeconds += waitFor([&]() { return m_freeSlots->tryPop(slot); });
+            auto start = std::chrono::steady_clock::now();
+            bool const hasChunk = m_source(slot);
+            stats.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (!hasChunk)
+                break;
+            stats.numItems++;
+            stats.outputStallSeconds += waitFor([&]() { return output.tryPush(slot); });
+        }
+        // Without further stages there is nobody to tell
+        if (!m_rings.empty())
+            waitFor([&]() { return output.tryPush(pipelineEndOfStream); });
+    }
+
+    void runStage(uint32_t stage)
+    {
+        StageStats & stats = m_stats[stage];
+        SpscRing<uint32_t> & input = *m_rings[stage - 1];
+        SpscRing<uint32_t> & output = getOutput(stage);
+        while (true)
+        {
+            uint32_t slot;
+            stats.inputStallSeconds += waitFor([&]() { return input.tryPop(slot); });
+            if (slot == pipelineEndOfStream)
+            {
+                if (stage < m_rings.size())
+                    waitFor([&]() { return output.tryPush(pipelineEndOfStream); });
+                break;
+            }
+            auto start = std::chrono::steady_clock::now();
+            m_stages[stage - 1](slot);
+            stats.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            stats.numItems++;
+            stats.outputStallSeconds += waitFor([&]() { return output.tryPush(slot); });
+        }
+    }
+
+    uint32_t m_numSlots;
+    uint32_t m_ringCapacity;
+    SourceFunction m_source;
+    std::vector<StageFunction> m_stages;
+    std::vector<StageStats> m_stats;
+    std::unique_ptr<SpscRing<uint32_t>> m_freeSlots;
+    std::vector<std::unique_ptr<SpscRing<uint32_t>>> m_rings;
+    double m_wallSeconds = 0.0;
+};
@@ -0,0 +1,87 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <alpaka/alpaka.hpp>
+
+#include "pointFile.hpp"
+
+#include <cstdint>
+
+// Decoders of point file columns for use in kernels.
+// A decoder returns coordinate i of an encoded column, so kernels read the encoded
+// bytes directly and decoded floats are never stored in memory.
+// Kernels take the decoder as a template argument, and the host selects it
+// by the encoding of the file with dispatchPointDecoder.
+
+struct Float32Decoder {
+    ALPAKA_FN_HOST_ACC float operator()(unsigned char const * column, uint32_t i) const
+    {
+        // Columns and chunks are aligned, so the floats can be read directly
+        return reinterpret_cast<float const *>(column)[i];
+    }
+};
+
+struct Fixed16Decoder {
+    // r / 65535
+    float scale;
+
+    ALPAKA_FN_HOST_ACC float operator()(unsigned char const * column, uint32_t i) const
+    {
+        uint32_t value = column[2 * i] | (column[2 * i + 1] << 8);
+        return value * scale;
+    }
+};
+
+// Decoder of Fixed16Shuffled columns of n points, which start at a chunk boundary
+struct Fixed16ShuffledDecoder {
+    // r / 65535
+    float scale;
+    // A power of two
+    uint32_t chunkPoints;
+    uint32_t n;
+
+    ALPAKA_FN_HOST_ACC float operator()(unsigned char const * column, uint32_t i) const
+    {
+        // Low bytes of the chunk are followed by its high bytes, the last chunk may be shorter
+        uint32_t chunkFirst = i & ~(chunkPoints - 1);
+        uint32_t chunkCount = (n - chunkFirst < chunkPoints) ? n - chunkFirst : chunkPoints;
+        unsigned char const * chunk = column + 2 * chunkFirst;
+        uint32_t value = chunk[i - chunkFirst] | (chunk[chunkCount + i - chunkFirst] << 8);
+        return value * scale;
+    }
+};
+
+// Call function with the decoder for the encoding of the header,
+// for columns of n points starting at a chunk boundary
+template<typename TFunction>
+auto dispatchPointDecoder(PointFileHeader const & header, uint32_t n, TFunction && function)
+    -> decltype(function(Float32Decoder{}))
+{
+    float const scale = header.r / fixed16Max;
+    switch (header.encoding)
+    {
+    case PointEncoding::Fixed16:
+        return function(Fixed16Decoder{scale});
+    case PointEncoding::Fixed16Shuffled:
+        return function(Fixed16ShuffledDecoder{scale, header.chunkPoints, n});
+    case PointEncoding::Float32:
+        break;
+    }
+    return function(Float32Decoder{});
+}
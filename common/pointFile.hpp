@@ -0,0 +1,466 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Binary columnar file of 2d points, so that points can be memory-mapped and used
+// by kernels without parsing. The layout is:
+// - a 64 byte header,
+// - the x column of numPoints encoded coordinates at xOffset,
+// - the y column of numPoints encoded coordinates at yOffset,
+// - optionally, the bounding box of the points of every chunk of chunkPoints points at statsOffset.
+// Column offsets are multiples of pointFileAlignment, which is a multiple of both
+// the cache line and the page size, so mapped columns are suitably aligned for vector loads.
+// All values are stored little-endian, in the native representation of x86 and ARM hosts.
+// Version 2 added the 16 bit encodings, version 1 files only contain floats.
+// Version 3 added the chunk statistics, statsOffset is 0 for files without them.
+// The columns are decoded by kernels, see pointDecoding.hpp.
+
+constexpr char pointFileMagic[8] = {'P', 'I', 'P', 'O', 'I', 'N', 'T', 'S'};
+constexpr uint32_t pointFileVersion = 3;
+constexpr uint64_t pointFileAlignment = 4096;
+constexpr uint32_t pointFileDefaultChunkPoints = 1u << 16;
+
+// Encodings of the coordinates
+enum class PointEncoding : uint32_t {
+    // Raw 32 bit floats
+    Float32 = 0,
+    // 16 bit fixed point q, representing the coordinate q / 65535 * r
+    Fixed16 = 1,
+    // Fixed16 with the bytes shuffled in chunks of chunkPoints coordinates:
+    // the low bytes of all coordinates of a chunk, followed by their high bytes.
+    // Bytes of the same significance compress better, e.g. with file system compression.
+    Fixed16Shuffled = 2
+};
+
+inline char const * getPointEncodingName(PointEncoding encoding)
+{
+    switch (encoding)
+    {
+    case PointEncoding::Float32:
+        return "float32";
+    case PointEncoding::Fixed16:
+        return "fixed16";
+    case PointEncoding::Fixed16Shuffled:
+        return "fixed16shuffled";
+    }
+    return "unknown";
+}
+
+// Bytes per encoded coordinate
+inline uint32_t getPointBytes(PointEncoding encoding)
+{
+    return (encoding == PointEncoding::Float32) ? 4 : 2;
+}
+
+// Largest fixed point value, representing r
+constexpr float fixed16Max = 65535.0f;
+
+// Quantize a coordinate in [0, r] to 16 bit fixed point, values outside are clamped
+inline uint16_t encodeFixed16(float value, float r)
+{
+    float const scaled = std::round(value / r * fixed16Max);
+    return static_cast<uint16_t>(std::fmin(std::fmax(scaled, 0.0f), fixed16Max));
+}
+
+// Coordinate of a 16 bit fixed point value, computed as by the decoders of the kernels
+inline float decodeFixed16(uint16_t value, float r)
+{
+    float const scale = r / fixed16Max;
+    return value * scale;
+}
+
+// Bounding box of the decoded points of a chunk
+struct ChunkStats {
+    float minX;
+    float maxX;
+    float minY;
+    float maxY;
+};
+
+struct PointFileHeader {
+    char magic[8];
+    uint32_t version;
+    PointEncoding encoding;
+    uint64_t numPoints;
+    uint64_t xOffset;
+    uint64_t yOffset;
+    // Coordinates are in [0, r]
+    float r;
+    // Points per chunk of Fixed16Shuffled and of the chunk statistics, a power of two
+    uint32_t chunkPoints;
+    uint64_t statsOffset;
+    uint32_t reserved[2];
+};
+
+static_assert(sizeof(PointFileHeader) == 64, "The point file header must be 64 bytes");
+
+// Header of a file with numPoints points, with columns directly following each other
+inline PointFileHeader makePointFileHeader(uint64_t numPoints, float r,
+    PointEncoding encoding = PointEncoding::Float32, uint32_t chunkPoints = pointFileDefaultChunkPoints)
+{
+    PointFileHeader header{};
+    std::memcpy(header.magic, pointFileMagic, sizeof(header.magic));
+    header.version = pointFileVersion;
+    header.encoding = encoding;
+    header.numPoints = numPoints;
+    uint64_t const columnBytes = (numPoints * getPointBytes(encoding) + pointFileAlignment - 1)
+        / pointFileAlignment * pointFileAlignment;
+    header.xOffset = pointFileAlignment;
+    header.yOffset = header.xOffset + columnBytes;
+    header.r = r;
+    header.chunkPoints = chunkPoints;
+    header.statsOffset = header.yOffset + columnBytes;
+    return header;
+}
+
+inline uint64_t getNumStatsChunks(PointFileHeader const & header)
+{
+    return (header.numPoints + header.chunkPoints - 1) / header.chunkPoints;
+}
+
+// Read-only memory mapping of a point file
+class PointFile {
+public:
+    PointFile() = default;
+
+    PointFile(PointFile && other) noexcept
+        : m_data(other.m_data), m_bytes(other.m_bytes), m_header(other.m_header), m_error(std::move(other.m_error))
+    {
+        other.m_data = nullptr;
+    }
+
+    PointFile & operator=(PointFile && other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_bytes, other.m_bytes);
+        std::swap(m_header, other.m_header);
+        std::swap(m_error, other.m_error);
+        return *this;
+    }
+
+    PointFile(PointFile const &) = delete;
+    PointFile & operator=(PointFile const &) = delete;
+
+    ~PointFile()
+    {
+        if (m_data)
+            munmap(m_data, m_bytes);
+    }
+
+    // Map the file and validate its header.
+    // On failure returns an empty handle, getError() tells the reason.
+    static PointFile open(std::string const & path)
+    {
+        PointFile file;
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            file.m_error = "cannot open " + path + ": " + std::strerror(errno);
+            return file;
+        }
+        struct stat status;
+        if (fstat(fd, &status) != 0 || static_cast<uint64_t>(status.st_size) < sizeof(PointFileHeader))
+        {
+            file.m_error = path + " is too short for a point file";
+            ::close(fd);
+            return file;
+        }
+        std::size_t const bytes = static_cast<std::size_t>(status.st_size);
+        void * data = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        // The mapping stays valid after closing the file
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            file.m_error = "cannot map " + path + ": " + std::strerror(errno);
+            return file;
+        }
+        file.m_data = data;
+        file.m_bytes = bytes;
+        std::memcpy(&file.m_header, data, sizeof(PointFileHeader));
+        if (!file.validate())
+        {
+            file.m_error = path + ": " + file.m_error;
+            munmap(file.m_data, file.m_bytes);
+            file.m_data = nullptr;
+        }
+        return file;
+    }
+
+    PointFileHeader const & getHeader() const
+    {
+        return m_header;
+    }
+
+    uint64_t getNumPoints() const
+    {
+        return m_header.numPoints;
+    }
+
+    PointEncoding getEncoding() const
+    {
+        return m_header.encoding;
+    }
+
+    // Encoded columns
+    unsigned char const * getXData() const
+    {
+        return static_cast<unsigned char const *>(m_data) + m_header.xOffset;
+    }
+
+    unsigned char const * getYData() const
+    {
+        return static_cast<unsigned char const *>(m_data) + m_header.yOffset;
+    }
+
+    // Bounding boxes of the chunks of chunkPoints points, nullptr for files without statistics
+    ChunkStats const * getChunkStats() const
+    {
+        if (m_header.statsOffset == 0)
+            return nullptr;
+        return reinterpret_cast<ChunkStats const *>(static_cast<char const *>(m_data) + m_header.statsOffset);
+    }
+
+    // Columns of Float32 files
+    float const * getX() const
+    {
+        return reinterpret_cast<float const *>(static_cast<char const *>(m_data) + m_header.xOffset);
+    }
+
+    float const * getY() const
+    {
+        return reinterpret_cast<float const *>(static_cast<char const *>(m_data) + m_header.yOffset);
+    }
+
+    // Give advice about the use of points [first, first + count) in both columns,
+    // e.g. MADV_WILLNEED to read them ahead or MADV_DONTNEED to drop them from the process.
+    // The range is extended to whole pages.
+    void advise(uint64_t first, uint64_t count, int advice) const
+    {
+        adviseColumn(m_header.xOffset, first, count, advice);
+        adviseColumn(m_header.yOffset, first, count, advice);
+    }
+
+    std::string const & getError() const
+    {
+        return m_error;
+    }
+
+    explicit operator bool() const
+    {
+        return m_data != nullptr;
+    }
+
+private:
+    bool validate()
+    {
+        if (std::memcmp(m_header.magic, pointFileMagic, sizeof(pointFileMagic)) != 0)
+            m_error = "not a point file";
+        else if (m_header.version < 1 || m_header.version > pointFileVersion)
+            m_error = "unsupported version " + std::to_string(m_header.version);
+        else if (m_header.encoding != PointEncoding::Float32 && m_header.encoding != PointEncoding::Fixed16
+                 && m_header.encoding != PointEncoding::Fixed16Shuffled)
+            m_error = "unsupported encoding";
+        else if (m_header.version == 1 && m_header.encoding != PointEncoding::Float32)
+            m_error = "encoding not supported by version 1";
+        else if ((m_header.encoding == PointEncoding::Fixed16Shuffled || hasStats())
+                 && (m_header.chunkPoints == 0 || (m_header.chunkPoints & (m_header.chunkPoints - 1)) != 0))
+            m_error = "invalid chunk size";
+        else if (m_header.xOffset % pointFileAlignment != 0 || m_header.yOffset % pointFileAlignment != 0)
+            m_error = "misaligned columns";
+        else if (!containsColumn(m_header.xOffset) || !containsColumn(m_header.yOffset))
+            m_error = "truncated columns";
+        else if (hasStats()
+                 && (m_header.statsOffset % pointFileAlignment != 0 || m_header.statsOffset > m_bytes
+                     || getNumStatsChunks(m_header) * sizeof(ChunkStats) > m_bytes - m_header.statsOffset))
+            m_error = "truncated chunk statistics";
+        // Earlier versions have no statistics, the field was reserved
+        if (!hasStats())
+            m_header.statsOffset = 0;
+        return m_error.empty();
+    }
+
+    bool hasStats() const
+    {
+        return m_header.version >= 3 && m_header.statsOffset != 0;
+    }
+
+    bool containsColumn(uint64_t offset) const
+    {
+        uint64_t const pointBytes = getPointBytes(m_header.encoding);
+        uint64_t const columnBytes = m_header.numPoints * pointBytes;
+        return columnBytes / pointBytes == m_header.numPoints && offset <= m_bytes
+            && columnBytes <= m_bytes - offset;
+    }
+
+    void adviseColumn(uint64_t offset, uint64_t first, uint64_t count, int advice) const
+    {
+        uint64_t const pageBytes = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        uint64_t const pointBytes = getPointBytes(m_header.encoding);
+        uint64_t const begin = (offset + first * pointBytes) / pageBytes * pageBytes;
+        uint64_t const end = offset + (first + count) * pointBytes;
+        madvise(static_cast<char *>(m_data) + begin, static_cast<std::size_t>(end - begin), advice);
+    }
+
+    void * m_data = nullptr;
+    std::size_t m_bytes = 0;
+    PointFileHeader m_header{};
+    std::string m_error;
+};
+
+// Writer of a point file in consecutive ranges of points, so that files larger than memory
+// can be generated. The file is created with its final size on construction.
+// With the Fixed16Shuffled encoding, ranges have to consist of whole chunks,
+// except for the last range of the file.
+class PointFileWriter {
+public:
+    PointFileWriter(std::string const & path, uint64_t numPoints, float r,
+        PointEncoding encoding = PointEncoding::Float32, uint32_t chunkPoints = pointFileDefaultChunkPoints)
+        : m_header(makePointFileHeader(numPoints, r, encoding, chunkPoints))
+    {
+        m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (m_fd < 0)
+            return;
+        m_stats.resize(getNumStatsChunks(m_header),
+            ChunkStats{HUGE_VALF, -HUGE_VALF, HUGE_VALF, -HUGE_VALF});
+        uint64_t const bytes = m_header.statsOffset + m_stats.size() * sizeof(ChunkStats);
+        if (ftruncate(m_fd, static_cast<off_t>(bytes)) != 0
+            || !writeAll(&m_header, sizeof(m_header), 0))
+        {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    PointFileWriter(PointFileWriter const &) = delete;
+    PointFileWriter & operator=(PointFileWriter const &) = delete;
+
+    ~PointFileWriter()
+    {
+        close();
+    }
+
+    // Write count points starting with point first, return false on failure
+    bool write(uint64_t first, float const * x, float const * y, std::size_t count)
+    {
+        if (m_fd < 0 || first + count > m_header.numPoints)
+            return false;
+        updateStats(first, x, y, count);
+        if (m_header.encoding == PointEncoding::Float32)
+            return writeAll(x, count * sizeof(float), m_header.xOffset + first * sizeof(float))
+                && writeAll(y, count * sizeof(float), m_header.yOffset + first * sizeof(float));
+        if (m_header.encoding == PointEncoding::Fixed16Shuffled
+            && (first % m_header.chunkPoints != 0
+                || (count % m_header.chunkPoints != 0 && first + count != m_header.numPoints)))
+            return false;
+        return writeFixed16(m_header.xOffset, first, x, count) && writeFixed16(m_header.yOffset, first, y, count);
+    }
+
+    // Write the chunk statistics, flush and close the file, return false on failure
+    bool close()
+    {
+        if (m_fd < 0)
+            return false;
+        bool const isWritten = writeAll(m_stats.data(), m_stats.size() * sizeof(ChunkStats), m_header.statsOffset);
+        bool const isClosed = ::close(m_fd) == 0 && isWritten;
+        m_fd = -1;
+        return isClosed;
+    }
+
+    explicit operator bool() const
+    {
+        return m_fd >= 0;
+    }
+
+private:
+    // Extend the bounding boxes by the points as they are decoded from the file
+    void updateStats(uint64_t first, float const * x, float const * y, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            float xi = x[i];
+            float yi = y[i];
+            if (m_header.encoding != PointEncoding::Float32)
+            {
+                xi = decodeFixed16(encodeFixed16(xi, m_header.r), m_header.r);
+                yi = decodeFixed16(encodeFixed16(yi, m_header.r), m_header.r);
+            }
+            ChunkStats & stats = m_stats[(first + i) / m_header.chunkPoints];
+            stats.minX = std::fmin(stats.minX, xi);
+            stats.maxX = std::fmax(stats.maxX, xi);
+            stats.minY = std::fmin(stats.minY, yi);
+            stats.maxY = std::fmax(stats.maxY, yi);
+        }
+    }
+
+    bool writeFixed16(uint64_t offset, uint64_t first, float const * values, std::size_t count)
+    {
+        m_encoded.resize(2 * count);
+        bool const isShuffled = m_header.encoding == PointEncoding::Fixed16Shuffled;
+        for (std::size_t chunkFirst = 0; chunkFirst < count; chunkFirst += m_header.chunkPoints)
+        {
+            std::size_t const chunkCount = std::min<std::size_t>(m_header.chunkPoints, count - chunkFirst);
+            unsigned char * chunk = m_encoded.data() + 2 * chunkFirst;
+            for (std::size_t i = 0; i < chunkCount; i++)
+            {
+                uint16_t const value = encodeFixed16(values[chunkFirst + i], m_header.r);
+                unsigned char const low = static_cast<unsigned char>(value & 0xff);
+                unsigned char const high = static_cast<unsigned char>(value >> 8);
+                chunk[isShuffled ? i : 2 * i] = low;
+                chunk[isShuffled ? chunkCount + i : 2 * i + 1] = high;
+            }
+        }
+        return writeAll(m_encoded.data(), m_encoded.size(), offset + 2 * first);
+    }
+
+    bool writeAll(void const * data, std::size_t bytes, uint64_t offset)
+    {
+        auto const * ptr = static_cast<char const *>(data);
+        while (bytes > 0)
+        {
+            ssize_t written = pwrite(m_fd, ptr, bytes, static_cast<off_t>(offset));
+            if (written < 0 && errno == EINTR)
+                continue;
+            if (written <= 0)
+                return false;
+            ptr += written;
+            bytes -= static_cast<std::size_t>(written);
+            offset += static_cast<uint64_t>(written);
+        }
+        return true;
+    }
+
+    PointFileHeader m_header;
+    int m_fd = -1;
+    std::vector<unsigned char> m_encoded;
+    std::vector<ChunkStats> m_stats;
+};
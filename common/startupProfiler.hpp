@@ -0,0 +1,191 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <alpaka/alpaka.hpp>
+
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED) || defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+#include <omp.h>
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+#include <tbb/parallel_for.h>
+#endif
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Profiling of the steps before the first kernel runs: platform enumeration, device selection,
+// queue construction, kernel task creation and the first launch, which starts the thread pool
+// of the OpenMP or TBB runtime unless it was started before.
+// A cold run is the first one in a process, a warm run repeats the same steps in the same process.
+// For a cold run free of previous initialization, runForked starts it in a child process.
+
+// When the runtime of the back-end starts its threads
+enum class InitStrategy {
+    // In the first kernel launch
+    Lazy,
+    // Right at the start, before the device is selected
+    Eager
+};
+
+inline char const * getInitStrategyName(InitStrategy strategy)
+{
+    return (strategy == InitStrategy::Eager) ? "eager" : "lazy";
+}
+
+// Start the threads of the runtime of the back-end.
+// Back-ends without a thread pool, like AccCpuSerial and AccCpuThreads,
+// which starts threads for every block, have nothing to start.
+template<typename Acc>
+struct RuntimeSpinUp {
+    static void run()
+    {
+    }
+};
+
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+// The first parallel region creates the threads of the team
+template<typename Dim, typename Idx>
+struct RuntimeSpinUp<alpaka::acc::AccCpuOmp2Blocks<Dim, Idx>> {
+    static void run()
+    {
+#pragma omp parallel
+        {
+        }
+    }
+};
+#endif
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+template<typename Dim, typename Idx>
+struct RuntimeSpinUp<alpaka::acc::AccCpuOmp2Threads<Dim, Idx>> {
+    static void run()
+    {
+#pragma omp parallel
+        {
+        }
+    }
+};
+#endif
+
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+// The first parallel algorithm creates the arena and its worker threads
+template<typename Dim, typename Idx>
+struct RuntimeSpinUp<alpaka::acc::AccCpuTbbBlocks<Dim, Idx>> {
+    static void run()
+    {
+        tbb::parallel_for(0, 1024, [](int) {});
+    }
+};
+#endif
+
+// Durations of named steps, each measured from the end of the previous one
+class StartupProfiler {
+public:
+    StartupProfiler()
+    {
+        restart();
+    }
+
+    void restart()
+    {
+        m_steps.clear();
+        m_last = std::chrono::steady_clock::now();
+    }
+
+    // End the current step
+    void step(std::string const & name)
+    {
+        auto now = std::chrono::steady_clock::now();
+        m_steps.push_back(Step{name, std::chrono::duration<double, std::milli>(now - m_last).count()});
+        m_last = now;
+    }
+
+    std::size_t getNumSteps() const
+    {
+        return m_steps.size();
+    }
+
+    std::string const & getStepName(std::size_t step) const
+    {
+        return m_steps[step].name;
+    }
+
+    double getStepMillis(std::size_t step) const
+    {
+        return m_steps[step].millis;
+    }
+
+    double getTotalMillis() const
+    {
+        double total = 0.0;
+        for (auto const & step : m_steps)
+            total += step.millis;
+        return total;
+    }
+
+private:
+    struct Step {
+        std::string name;
+        double millis;
+    };
+
+    std::vector<Step> m_steps;
+    std::chrono::steady_clock::time_point m_last;
+};
+
+// Print the steps of a cold and a warm run with the same steps side by side
+inline void printStartupProfiles(std::string const & title, StartupProfiler const & cold,
+    StartupProfiler const & warm)
+{
+    std::cout << title << "\n";
+    std::cout << "    " << std::setw(32) << std::left << "step" << std::right << std::setw(12) << "cold ms"
+        << std::setw(12) << "warm ms" << "\n";
+    for (std::size_t step = 0; step < cold.getNumSteps() && step < warm.getNumSteps(); step++)
+        std::cout << "    " << std::setw(32) << std::left << cold.getStepName(step) << std::right << std::setw(12)
+            << cold.getStepMillis(step) << std::setw(12) << warm.getStepMillis(step) << "\n";
+    std::cout << "    " << std::setw(32) << std::left << "total" << std::right << std::setw(12)
+        << cold.getTotalMillis() << std::setw(12) << warm.getTotalMillis() << std::endl;
+}
+
+// Run function in a forked child process, and return whether it returned 0.
+// The child starts without initialized runtimes, as long as the calling process
+// has not initialized any, so each call measures a cold start.
+inline bool runForked(std::function<int()> const & function)
+{
+    std::cout << std::flush;
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        int status = function();
+        std::cout << std::flush;
+        _exit(status);
+    }
+    if (pid < 0)
+        return false;
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
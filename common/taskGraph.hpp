@@ -0,0 +1,74 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <alpaka/alpaka.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Recorded sequence of queue operations, e.g. copies to the device, a kernel and a copy back,
+// which is replayed into a queue as many times as needed.
+// The tasks of the operations are created once when recording, so that a replay
+// only enqueues them, without creating tasks and work divisions again.
+// The tasks refer to the memory of the buffers and views given when recording,
+// so these have to outlive the graph. Kernel arguments are recorded by value;
+// parameters to be changed between replays are passed to the kernel in a small buffer instead,
+// which a recorded copy fills from host memory, see addCopy.
+// The host memory must only be changed when the previous replay has finished.
+template<typename TQueue>
+class TaskGraph {
+public:
+    // Record a copy of the given extent
+    template<typename TViewDst, typename TViewSrc, typename TExtent>
+    void addCopy(TViewDst & viewDst, TViewSrc const & viewSrc, TExtent const & extent)
+    {
+        addTask(alpaka::mem::view::createTaskCopy(viewDst, viewSrc, extent));
+    }
+
+    // Record setting each byte of the given extent to a value
+    template<typename TView, typename TExtent>
+    void addSet(TView & view, std::uint8_t byte, TExtent const & extent)
+    {
+        addTask(alpaka::mem::view::createTaskSet(view, byte, extent));
+    }
+
+    // Record a task, e.g. a kernel task from createTaskKernel
+    template<typename TTask>
+    void addTask(TTask task)
+    {
+        m_nodes.emplace_back([task](TQueue & queue) { alpaka::queue::enqueue(queue, task); });
+    }
+
+    // Enqueue all recorded operations in the order of recording, without waiting for them
+    void replay(TQueue & queue) const
+    {
+        for (auto const & node : m_nodes)
+            node(queue);
+    }
+
+    std::size_t getNumNodes() const
+    {
+        return m_nodes.size();
+    }
+
+private:
+    std::vector<std::function<void(TQueue &)>> m_nodes;
+};
@@ -0,0 +1,445 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+#include <omp.h>
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+#include <tbb/task_arena.h>
+#endif
+
+#include <sched.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// This example pins the worker threads of CPU back-ends to cores according to
+// a placement policy and reports where the workers actually ran.
+// Kernel timings are printed next to the placement, so that the best mapping can be chosen.
+// Workers pin themselves at the start of the kernel. Back-ends reusing a pool (OpenMP, TBB)
+// are pinned once in an untimed launch, while back-ends creating their threads per kernel
+// launch (AccCpuThreads) have to pin in every launch.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel
+struct Points {
+    float * x;
+    float * y;
+    bool * inside;
+};
+
+// Placement policies of the worker threads
+enum class Policy {
+    // No pinning, placement is left to the OS
+    None,
+    // Consecutive workers on neighboring logical CPUs, filling SMT siblings first
+    Compact,
+    // Consecutive workers spread over sockets, physical cores before SMT siblings
+    Scatter,
+    // One worker per physical core, SMT siblings are not used
+    PhysicalCores
+};
+
+char const * getPolicyName(Policy policy)
+{
+    switch (policy)
+    {
+    case Policy::None:
+        return "none";
+    case Policy::Compact:
+        return "compact";
+    case Policy::Scatter:
+        return "scatter";
+    case Policy::PhysicalCores:
+        return "cores";
+    }
+    return "unknown";
+}
+
+// Topology of a logical CPU, from sysfs
+struct CpuInfo {
+    int cpu;
+    int package;
+    int core;
+    // Rank of the CPU among its SMT siblings
+    int siblingRank;
+    std::string siblings;
+};
+
+int readTopologyValue(int cpu, char const * name)
+{
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name);
+    int value = 0;
+    file >> value;
+    return value;
+}
+
+// Topology of all logical CPUs the process may run on
+std::map<int, CpuInfo> readTopology()
+{
+    std::map<int, CpuInfo> topology;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    sched_getaffinity(0, sizeof(mask), &mask);
+    std::map<std::pair<int, int>, int> numSiblingsSeen;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (!CPU_ISSET(cpu, &mask))
+            continue;
+        CpuInfo info;
+        info.cpu = cpu;
+        info.package = readTopologyValue(cpu, "physical_package_id");
+        info.core = readTopologyValue(cpu, "core_id");
+        info.siblingRank = numSiblingsSeen[std::make_pair(info.package, info.core)]++;
+        std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/thread_siblings_list");
+        std::getline(file, info.siblings);
+        topology[cpu] = info;
+    }
+    return topology;
+}
+
+// Order in which logical CPUs are assigned to workers 0, 1, ...
+std::vector<int32_t> getCpuOrder(std::map<int, CpuInfo> const & topology, Policy policy)
+{
+    std::vector<CpuInfo> cpus;
+    for (auto const & entry : topology)
+        if (policy != Policy::PhysicalCores || entry.second.siblingRank == 0)
+            cpus.push_back(entry.second);
+    if (policy == Policy::None)
+        return {};
+    if (policy == Policy::Scatter)
+    {
+        // Rank of the core within its package, so that packages take turns
+        std::map<int, int> numCoresSeen;
+        std::map<std::pair<int, int>, int> coreRanks;
+        for (auto const & info : cpus)
+            if (info.siblingRank == 0)
+                coreRanks[std::make_pair(info.package, info.core)] = numCoresSeen[info.package]++;
+        std::sort(cpus.begin(), cpus.end(), [&](CpuInfo const & a, CpuInfo const & b) {
+            int const aRank = coreRanks[std::make_pair(a.package, a.core)];
+            int const bRank = coreRanks[std::make_pair(b.package, b.core)];
+            return std::tie(a.siblingRank, aRank, a.package) < std::tie(b.siblingRank, bRank, b.package);
+        });
+    }
+    else
+        std::sort(cpus.begin(), cpus.end(), [](CpuInfo const & a, CpuInfo const & b) {
+            return std::tie(a.package, a.core, a.siblingRank) < std::tie(b.package, b.core, b.siblingRank);
+        });
+    std::vector<int32_t> order;
+    for (auto const & info : cpus)
+        order.push_back(info.cpu);
+    return order;
+}
+
+// Index of the OS worker thread executing the calling kernel thread.
+// By default the threads of a block are the workers, as for AccCpuThreads and AccCpuSerial.
+template<typename Acc>
+struct WorkerIndex {
+    static uint32_t get(Acc const & acc)
+    {
+        return alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0];
+    }
+};
+
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+// Blocks are distributed between the threads of the OpenMP team
+template<typename Dim, typename Idx>
+struct WorkerIndex<alpaka::acc::AccCpuOmp2Blocks<Dim, Idx>> {
+    static uint32_t get(alpaka::acc::AccCpuOmp2Blocks<Dim, Idx> const &)
+    {
+        return static_cast<uint32_t>(omp_get_thread_num());
+    }
+};
+#endif
+
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+// Blocks are distributed between the threads of the TBB arena
+template<typename Dim, typename Idx>
+struct WorkerIndex<alpaka::acc::AccCpuTbbBlocks<Dim, Idx>> {
+    static uint32_t get(alpaka::acc::AccCpuTbbBlocks<Dim, Idx> const &)
+    {
+        int const index = tbb::this_task_arena::current_thread_index();
+        return (index < 0) ? 0u : static_cast<uint32_t>(index);
+    }
+};
+#endif
+
+// Pool of worker threads of a back-end, limited to the given number of workers.
+// By default the workers are created for every kernel launch, as for AccCpuThreads.
+template<typename Acc>
+class WorkerPool {
+public:
+    static constexpr bool isPersistent = false;
+
+    explicit WorkerPool(uint32_t)
+    {
+    }
+
+    template<typename Function>
+    void execute(Function && function)
+    {
+        function();
+    }
+};
+
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+// The OpenMP team is kept between parallel regions of the same size
+template<typename Dim, typename Idx>
+class WorkerPool<alpaka::acc::AccCpuOmp2Blocks<Dim, Idx>> {
+public:
+    static constexpr bool isPersistent = true;
+
+    explicit WorkerPool(uint32_t numWorkers)
+    {
+        omp_set_num_threads(static_cast<int>(numWorkers));
+    }
+
+    template<typename Function>
+    void execute(Function && function)
+    {
+        function();
+    }
+};
+#endif
+
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+// Kernels run in an arena with one slot per worker.
+// Threads may change slots between launches, which shows up in the reported placement.
+template<typename Dim, typename Idx>
+class WorkerPool<alpaka::acc::AccCpuTbbBlocks<Dim, Idx>> {
+public:
+    static constexpr bool isPersistent = true;
+
+    explicit WorkerPool(uint32_t numWorkers) : m_arena(static_cast<int>(numWorkers))
+    {
+    }
+
+    template<typename Function>
+    void execute(Function && function)
+    {
+        m_arena.execute(function);
+    }
+
+private:
+    tbb::task_arena m_arena;
+};
+#endif
+
+// Where each kernel thread was executed
+struct Placement {
+    uint32_t * workers;
+    int32_t * cpus;
+};
+
+// Kernel from the homework with striding and loop blocking, which first pins
+// the executing worker to cpuOrder[worker % numCpus] unless numCpus is 0,
+// and records the worker and the CPU for every kernel thread
+struct PixelFinderKernelPinned {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, uint32_t n,
+        int32_t const * cpuOrder, uint32_t numCpus, Placement placement) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t worker = WorkerIndex<Acc>::get(acc);
+        if (numCpus > 0)
+        {
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            CPU_SET(cpuOrder[worker % numCpus], &mask);
+            sched_setaffinity(0, sizeof(mask), &mask);
+        }
+        placement.workers[gridThreadIdx] = worker;
+        placement.cpus[gridThreadIdx] = sched_getcpu();
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float x = points.x[i];
+                float y = points.y[i];
+                float d = math::sqrt(acc, x * x + y * y);
+                points.inside[i] = (d <= r);
+            }
+        }
+    }
+};
+
+// Run the kernel with the given policy on the given back-end and report timing and placement
+template<typename Acc>
+void runWithPolicy(Policy policy, std::map<int, CpuInfo> const & topology, uint32_t n, float r)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+    static_assert(std::is_same<dev::Dev<Acc>, dev::DevCpu>::value, "Pinning is only supported for CPU accelerators");
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Use one worker per CPU of the policy, or per logical CPU without pinning: for back-ends
+    // with a single thread per block these are blocks, otherwise threads of a block
+    std::vector<int32_t> cpuOrder = getCpuOrder(topology, policy);
+    uint32_t numWorkers = static_cast<uint32_t>(cpuOrder.empty() ? topology.size() : cpuOrder.size());
+    WorkerPool<Acc> workerPool(numWorkers);
+    auto const devProps = acc::getAccDevProps<Acc>(device);
+    uint32_t threadsPerBlock = std::min(numWorkers, static_cast<uint32_t>(devProps.m_blockThreadExtentMax[0]));
+    uint32_t blocksPerGrid = (numWorkers + threadsPerBlock - 1) / threadsPerBlock;
+    uint32_t numThreads = blocksPerGrid * threadsPerBlock;
+    uint32_t elementsPerThread = (n + numThreads - 1) / numThreads;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    auto xBuffer = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto yBuffer = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto insideBuffer = mem::buf::alloc<bool, Idx>(device, bufferExtent);
+    Points points;
+    points.x = mem::view::getPtrNative(xBuffer);
+    points.y = mem::view::getPtrNative(yBuffer);
+    points.inside = mem::view::getPtrNative(insideBuffer);
+    std::mt19937 generator{2020};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        points.x[idx] = distribution(generator);
+        points.y[idx] = distribution(generator);
+    }
+
+    std::vector<uint32_t> workers(numThreads);
+    std::vector<int32_t> cpus(numThreads);
+    Placement placement{workers.data(), cpus.data()};
+
+    // Untimed run to start up the back-end and pin the workers,
+    // timed runs only pin again when the back-end does not keep its workers
+    uint32_t const numCpus = static_cast<uint32_t>(cpuOrder.size());
+    auto taskPinKernel = kernel::createTaskKernel<Acc>(workDiv, PixelFinderKernelPinned{}, points, r, n,
+        cpuOrder.data(), numCpus, placement);
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, PixelFinderKernelPinned{}, points, r, n,
+        cpuOrder.data(), WorkerPool<Acc>::isPersistent ? 0u : numCpus, placement);
+    workerPool.execute([&] {
+        queue::enqueue(queue, taskPinKernel);
+        alpaka::wait::wait(queue);
+    });
+    uint32_t numRepetitions = 5;
+    double bestDuration = 0.0;
+    for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        workerPool.execute([&] {
+            queue::enqueue(queue, taskRunKernel);
+            alpaka::wait::wait(queue);
+        });
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        if (repetition == 0 || duration.count() < bestDuration)
+            bestDuration = duration.count();
+    }
+
+    uint32_t P = 0;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (points.inside[i])
+            ++P;
+    }
+    float pi = 4.f * P / n;
+
+    // Output results: timing and the CPUs each worker ran on in the last run
+    std::cout << acc::getAccName<Acc>() << ", policy " << getPolicyName(policy) << ": computed pi is " << pi
+        << ", best time " << bestDuration << " ms\n";
+    std::map<uint32_t, std::set<int32_t>> workerCpus;
+    for (uint32_t thread = 0; thread < numThreads; thread++)
+        workerCpus[workers[thread]].insert(cpus[thread]);
+    for (auto const & entry : workerCpus)
+        for (int32_t cpu : entry.second)
+        {
+            auto const info = topology.find(cpu);
+            std::cout << "    worker " << entry.first << ": cpu " << cpu;
+            if (info != topology.end())
+                std::cout << ", socket " << info->second.package << ", core " << info->second.core
+                    << ", SMT siblings " << info->second.siblings;
+            std::cout << "\n";
+        }
+    std::cout << std::flush;
+}
+
+// Run all enabled CPU back-ends with the given policy
+void runAllBackEnds(Policy policy, std::map<int, CpuInfo> const & topology, uint32_t n, float r)
+{
+    using namespace alpaka;
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+    alpaka::ignore_unused(policy, topology, n, r);
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    runWithPolicy<acc::AccCpuOmp2Blocks<Dim, Idx>>(policy, topology, n, r);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    runWithPolicy<acc::AccCpuThreads<Dim, Idx>>(policy, topology, n, r);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    runWithPolicy<acc::AccCpuTbbBlocks<Dim, Idx>>(policy, topology, n, r);
+#endif
+}
+
+// Usage: computePi_affinity [none|compact|scatter|cores], all policies by default
+int main(int argc, char * argv[]) {
+    // The topology is read before any pinning, so it covers all CPUs available to the process
+    auto const topology = readTopology();
+    std::cout << "Topology:\n";
+    for (auto const & entry : topology)
+        std::cout << "    cpu " << entry.first << ": socket " << entry.second.package << ", core "
+            << entry.second.core << ", SMT siblings " << entry.second.siblings << "\n";
+
+    // Number of points and circle radius
+    uint32_t n = 10000000;
+    float r = 10.0f;
+
+    // Pinning persists after a kernel, also for the main thread which is part of the OpenMP team
+    // and passes its mask to threads it creates, so the unpinned policy has to go first
+    std::vector<Policy> policies = {Policy::None, Policy::Compact, Policy::Scatter, Policy::PhysicalCores};
+    if (argc > 1)
+    {
+        auto const selected = std::find_if(policies.begin(), policies.end(),
+            [&](Policy policy) { return std::strcmp(argv[1], getPolicyName(policy)) == 0; });
+        if (selected == policies.end())
+        {
+            std::cerr << "Unknown policy " << argv[1] << ", use one of none, compact, scatter, cores\n";
+            return 1;
+        }
+        policies = {*selected};
+    }
+    for (Policy policy : policies)
+        runAllBackEnds(policy, topology, n, r);
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// This example runs many small, independent Pi estimations in a single kernel launch.
+// Each estimation is described by a job, points are generated on the device,
+// so that only the job descriptors are copied to and the counts from the device.
+
+// Description of a single estimation
+struct Job {
+    // Seed of the random number generator
+    uint32_t seed;
+    // Circle radius, points are generated in [0, r]
+    float r;
+    // Number of points
+    uint32_t n;
+};
+
+// Each block processes one job at a time, the block index picks the job.
+// Threads of the block generate and classify the points of the job with a strided loop,
+// then add the number of points inside to the job's own counter.
+struct BatchedPixelFinderKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Job const * jobs, uint32_t * counts, uint32_t numJobs) const
+    {
+        using namespace alpaka;
+        uint32_t gridBlockIdx = idx::getIdx<Grid, Blocks>(acc)[0];
+        uint32_t gridBlockExtent = workdiv::getWorkDiv<Grid, Blocks>(acc)[0];
+        uint32_t blockThreadIdx = idx::getIdx<Block, Threads>(acc)[0];
+        uint32_t blockThreadExtent = workdiv::getWorkDiv<Block, Threads>(acc)[0];
+
+        for (uint32_t jobIdx = gridBlockIdx; jobIdx < numJobs; jobIdx += gridBlockExtent)
+        {
+            Job const job = jobs[jobIdx];
+            // Each thread uses its own subsequence of the job's random stream
+            auto generator = rand::generator::createDefault(acc, job.seed, blockThreadIdx);
+            auto distribution = rand::distribution::createUniformReal<float>(acc);
+            uint32_t localCount = 0;
+            for (uint32_t i = blockThreadIdx; i < job.n; i += blockThreadExtent)
+            {
+                float x = job.r * distribution(generator);
+                float y = job.r * distribution(generator);
+                float d = math::sqrt(acc, x * x + y * y);
+                if (d <= job.r)
+                    ++localCount;
+            }
+            // Only threads of this block work on the job, so atomics between threads suffice
+            atomic::atomicOp<atomic::op::Add>(acc, &counts[jobIdx], localCount, hierarchy::Threads{});
+        }
+    }
+};
+
+int main() {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    // Select the first device available on a system, for the chosen accelerator
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+
+    // Generate a set of small jobs with different seeds, radii and numbers of points
+    uint32_t numJobs = 4096;
+    std::mt19937 generator{2020};
+    std::uniform_int_distribution<uint32_t> nDistribution(1000, 10000);
+    std::uniform_real_distribution<float> rDistribution(1.0f, 10.0f);
+    vec::Vec<Dim, Idx> jobsExtent{numJobs};
+    auto jobsBufferHost = mem::buf::alloc<Job, Idx>(devHost, jobsExtent);
+    auto countsBufferHost = mem::buf::alloc<uint32_t, Idx>(devHost, jobsExtent);
+    Job * jobs = mem::view::getPtrNative(jobsBufferHost);
+    uint32_t * counts = mem::view::getPtrNative(countsBufferHost);
+    uint64_t totalPoints = 0;
+    for (uint32_t jobIdx = 0; jobIdx < numJobs; jobIdx++)
+    {
+        jobs[jobIdx] = Job{static_cast<uint32_t>(generator()), rDistribution(generator), nDistribution(generator)};
+        totalPoints += jobs[jobIdx].n;
+    }
+
+    auto const devProps = acc::getAccDevProps<Acc>(device);
+    uint32_t threadsPerBlock = std::min(static_cast<uint32_t>(devProps.m_blockThreadExtentMax[0]), 64u);
+    uint32_t elementsPerThread = 1;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    BatchedPixelFinderKernel batchedPixelFinderKernel;
+
+    // Batched mode: one allocation, one launch and one copy each way for all jobs
+    auto batchedStart = std::chrono::steady_clock::now();
+    auto jobsBufferAcc = mem::buf::alloc<Job, Idx>(device, jobsExtent);
+    auto countsBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, jobsExtent);
+    mem::view::copy(queue, jobsBufferAcc, jobsBufferHost, jobsExtent);
+    mem::view::set(queue, countsBufferAcc, 0u, jobsExtent);
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(WorkDiv{numJobs, threadsPerBlock, elementsPerThread},
+        batchedPixelFinderKernel, mem::view::getPtrNative(jobsBufferAcc), mem::view::getPtrNative(countsBufferAcc),
+        numJobs);
+    queue::enqueue(queue, taskRunKernel);
+    mem::view::copy(queue, countsBufferHost, countsBufferAcc, jobsExtent);
+    alpaka::wait::wait(queue);
+    std::chrono::duration<double, std::milli> batchedDuration = std::chrono::steady_clock::now() - batchedStart;
+    std::vector<uint32_t> batchedCounts(counts, counts + numJobs);
+
+    // For comparison, the same jobs processed one by one, with the usual
+    // allocation, copies and launch per job
+    vec::Vec<Dim, Idx> singleExtent{1u};
+    auto singleStart = std::chrono::steady_clock::now();
+    for (uint32_t jobIdx = 0; jobIdx < numJobs; jobIdx++)
+    {
+        auto jobBufferAcc = mem::buf::alloc<Job, Idx>(device, singleExtent);
+        auto countBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, singleExtent);
+        auto jobView = mem::view::ViewPlainPtr<dev::DevCpu, Job, Dim, Idx>(jobs + jobIdx, devHost, singleExtent);
+        auto countView = mem::view::ViewPlainPtr<dev::DevCpu, uint32_t, Dim, Idx>(counts + jobIdx, devHost, singleExtent);
+        mem::view::copy(queue, jobBufferAcc, jobView, singleExtent);
+        mem::view::set(queue, countBufferAcc, 0u, singleExtent);
+        auto taskRunSingleKernel = kernel::createTaskKernel<Acc>(WorkDiv{1u, threadsPerBlock, elementsPerThread},
+            batchedPixelFinderKernel, mem::view::getPtrNative(jobBufferAcc), mem::view::getPtrNative(countBufferAcc),
+            1u);
+        queue::enqueue(queue, taskRunSingleKernel);
+        mem::view::copy(queue, countView, countBufferAcc, singleExtent);
+        alpaka::wait::wait(queue);
+    }
+    std::chrono::duration<double, std::milli> singleDuration = std::chrono::steady_clock::now() - singleStart;
+
+    // Both modes use the same random streams and so have to produce the same counts
+    uint32_t numMismatches = 0;
+    double piSum = 0.0;
+    for (uint32_t jobIdx = 0; jobIdx < numJobs; jobIdx++)
+    {
+        if (batchedCounts[jobIdx] != counts[jobIdx])
+            ++numMismatches;
+        piSum += 4.0 * batchedCounts[jobIdx] / jobs[jobIdx].n;
+    }
+
+    // Output results
+    std::cout << "Processed " << numJobs << " jobs with " << totalPoints << " points in total\n";
+    std::cout << "Mean computed pi is " << piSum / numJobs << "\n";
+    std::cout << "Batched execution time: " << batchedDuration.count() << " ms\n";
+    std::cout << "One-by-one execution time: " << singleDuration.count() << " ms\n";
+    std::cout << "Mismatching counts: " << numMismatches << std::endl;
+
+    return numMismatches == 0 ? 0 : 1;
+}
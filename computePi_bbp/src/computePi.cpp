@@ -0,0 +1,238 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// This example computes hexadecimal digits of Pi with the Bailey-Borwein-Plouffe formula
+//     pi = sum_k 16^-k * (4/(8k+1) - 2/(8k+4) - 1/(8k+5) - 1/(8k+6)),
+// which allows computing digits starting at an arbitrary position without computing
+// the preceding ones. In contrast to the PixelFinder kernels, it is purely integer-
+// and compute-bound and has no memory traffic besides writing the resulting digits.
+
+// Number of hex digits each thread extracts starting at its position.
+// Double precision reliably gives a few more digits than that, see the overlap check on host.
+constexpr uint32_t digitsPerWindow = 8;
+
+// Compute 16^exponent mod modulus with binary exponentiation in 64-bit integers.
+// The modulus is required to be below 2^32, so that products never overflow.
+ALPAKA_FN_HOST_ACC uint64_t modPow16(uint64_t exponent, uint64_t modulus)
+{
+    if (modulus == 1)
+        return 0;
+    uint64_t result = 1;
+    uint64_t base = 16 % modulus;
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+            result = (result * base) % modulus;
+        base = (base * base) % modulus;
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// Fractional part of a value, works for negative values as well
+template<typename Acc>
+ALPAKA_FN_ACC double fractionalPart(Acc const & acc, double value)
+{
+    using namespace alpaka;
+    double result = value - math::floor(acc, value);
+    // For tiny negative values the difference rounds to 1, which is 0 modulo 1
+    return (result < 1.0) ? result : 0.0;
+}
+
+// Fractional part of 16^position * sum_k 16^-k / (8k + j).
+// The head of the series (k <= position) is partitioned into elementExtent contiguous
+// blocks of terms, which are summed separately and then combined.
+template<typename Acc>
+ALPAKA_FN_ACC double seriesFraction(Acc const & acc, uint64_t position, uint32_t j, uint32_t elementExtent)
+{
+    uint64_t const numHeadTerms = position + 1;
+    uint64_t const termsPerElement = (numHeadTerms + elementExtent - 1) / elementExtent;
+    double sum = 0.0;
+    for (uint32_t element = 0; element < elementExtent; element++)
+    {
+        uint64_t const begin = element * termsPerElement;
+        uint64_t const end = (begin + termsPerElement < numHeadTerms) ? begin + termsPerElement : numHeadTerms;
+        double elementSum = 0.0;
+        for (uint64_t k = begin; k < end; k++)
+        {
+            uint64_t const denominator = 8 * k + j;
+            elementSum += static_cast<double>(modPow16(position - k, denominator)) / denominator;
+            elementSum = fractionalPart(acc, elementSum);
+        }
+        sum = fractionalPart(acc, sum + elementSum);
+    }
+
+    // Tail of the series (k > position) has negative powers of 16 and converges fast
+    double power = 1.0 / 16.0;
+    for (uint64_t k = position + 1; power > 1e-17; k++)
+    {
+        sum += power / (8 * k + j);
+        power /= 16.0;
+    }
+    return fractionalPart(acc, sum);
+}
+
+// Each thread computes windows of digitsPerWindow hex digits of Pi after the point,
+// the window w starts at position firstPosition + w * windowStride.
+// Windows are distributed between threads with the strided loop from the homework,
+// the element layer is used to partition the terms of each series.
+struct BbpDigitsKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, uint8_t * digits,
+        uint64_t firstPosition, uint32_t windowStride, uint32_t numWindows) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        for (uint32_t window = gridThreadIdx; window < numWindows; window += gridThreadExtent)
+        {
+            uint64_t position = firstPosition + static_cast<uint64_t>(window) * windowStride;
+            double x = 4.0 * seriesFraction(acc, position, 1, threadElementExtent)
+                - 2.0 * seriesFraction(acc, position, 4, threadElementExtent)
+                - seriesFraction(acc, position, 5, threadElementExtent)
+                - seriesFraction(acc, position, 6, threadElementExtent);
+            x = fractionalPart(acc, x);
+            for (uint32_t i = 0; i < digitsPerWindow; i++)
+            {
+                x *= 16.0;
+                double digit = math::floor(acc, x);
+                digits[window * digitsPerWindow + i] = static_cast<uint8_t>(digit);
+                x -= digit;
+            }
+        }
+    }
+};
+
+// Leading hex digits of Pi after the point, used to validate the results
+static char const * const referencePiHexDigits =
+    "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89"
+    "452821E638D01377BE5466CF34E90C6CC0AC29B7C97C50DD3F84D5B5B5470917";
+
+// Usage: computePi_bbp [firstPosition] [numDigits]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    // Select the first device available on a system, for the chosen accelerator
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Position (0-based, after the hex point) of the first digit and number of digits
+    uint64_t firstPosition = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 0;
+    uint32_t numDigits = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1000;
+    if (numDigits == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [firstPosition] [numDigits], with numDigits > 0\n";
+        return 1;
+    }
+
+    // Consecutive windows overlap by digitsPerWindow - windowStride digits,
+    // these are used to cross-check the precision of the results
+    uint32_t windowStride = digitsPerWindow - 2;
+    uint32_t numWindows = (numDigits + windowStride - 1) / windowStride;
+
+    // Moduli 8k + 6 with k up to the last position have to stay below 2^32
+    uint64_t lastPosition = firstPosition + static_cast<uint64_t>(numWindows) * windowStride;
+    if (8 * lastPosition + 6 >= (uint64_t{1} << 32))
+    {
+        std::cerr << "Positions beyond " << ((uint64_t{1} << 32) - 6) / 8 << " are not supported\n";
+        return 1;
+    }
+
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    vec::Vec<Dim, Idx> bufferExtent{numWindows * digitsPerWindow};
+    auto digitsBufferHost = mem::buf::alloc<uint8_t, Idx>(devHost, bufferExtent);
+    auto digitsBufferAcc = mem::buf::alloc<uint8_t, Idx>(device, bufferExtent);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // One window per thread, the element layer partitions the series
+    uint32_t blocksPerGrid = numWindows;
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = 4;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    BbpDigitsKernel bbpDigitsKernel;
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, bbpDigitsKernel,
+        mem::view::getPtrNative(digitsBufferAcc), firstPosition, windowStride, numWindows);
+    queue::enqueue(queue, taskRunKernel);
+    mem::view::copy(queue, digitsBufferHost, digitsBufferAcc, bufferExtent);
+    alpaka::wait::wait(queue);
+
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> duration = end - start;
+
+    // Assemble the digit range from the windows and validate the overlapping parts
+    uint8_t const * windowDigits = mem::view::getPtrNative(digitsBufferHost);
+    uint8_t const unknownDigit = 0xFF;
+    std::vector<uint8_t> digits(numDigits, unknownDigit);
+    uint32_t numOverlapMismatches = 0;
+    for (uint32_t window = 0; window < numWindows; window++)
+        for (uint32_t i = 0; i < digitsPerWindow; i++)
+        {
+            uint32_t offset = window * windowStride + i;
+            if (offset >= numDigits)
+                break;
+            uint8_t digit = windowDigits[window * digitsPerWindow + i];
+            if (digits[offset] == unknownDigit)
+                digits[offset] = digit;
+            else if (digits[offset] != digit)
+                ++numOverlapMismatches;
+        }
+
+    // Compare with the known digits, when the range intersects them
+    std::string const reference = referencePiHexDigits;
+    char const * const hexChars = "0123456789ABCDEF";
+    std::string result;
+    uint32_t numReferenceMismatches = 0;
+    for (uint32_t offset = 0; offset < numDigits; offset++)
+    {
+        result += hexChars[digits[offset]];
+        uint64_t position = firstPosition + offset;
+        if (position < reference.size() && reference[position] != result.back())
+            ++numReferenceMismatches;
+    }
+
+    // Output results
+    std::cout << "Hex digits of pi from position " << firstPosition << ": "
+        << result.substr(0, 64) << (numDigits > 64 ? "..." : "") << "\n";
+    std::cout << "Overlap mismatches: " << numOverlapMismatches
+        << ", reference mismatches: " << numReferenceMismatches << "\n";
+    std::cout << "Execution time: " << duration.count() << " ms ("
+        << numDigits / duration.count() * 1e3 << " digits/s)" << std::endl;
+
+    return (numOverlapMismatches == 0 && numReferenceMismatches == 0) ? 0 : 1;
+}
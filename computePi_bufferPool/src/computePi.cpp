@@ -0,0 +1,191 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "bufferPool.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// This example repeatedly estimates Pi with different numbers of points,
+// as a long-running process would do. All buffers are taken from caching pools,
+// so after the first iterations no allocations take place any more.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel
+struct Points {
+    float * x;
+    float * y;
+    bool * inside;
+};
+
+// Kernel from the homework, with striding and loop blocking
+struct PixelFinderKernelMultiplePointsPerThreadElements {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float x = points.x[i];
+                float y = points.y[i];
+                float d = math::sqrt(acc, x * x + y * y);
+                points.inside[i] = (d <= r);
+            }
+        }
+    }
+};
+
+// Estimate Pi with n points using the given buffers, which may be larger than n
+template<typename Acc, typename Queue, typename BufHostFloat, typename BufHostBool, typename BufAccFloat,
+    typename BufAccBool>
+float estimatePi(Queue & queue, BufHostFloat & xBufferHost, BufHostFloat & yBufferHost,
+    BufHostBool & insideBufferHost, BufAccFloat & xBufferAcc, BufAccFloat & yBufferAcc,
+    BufAccBool & insideBufferAcc, uint32_t n, float r, std::mt19937 & generator)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+
+    Points pointsHost;
+    pointsHost.x = mem::view::getPtrNative(xBufferHost);
+    pointsHost.y = mem::view::getPtrNative(yBufferHost);
+    pointsHost.inside = mem::view::getPtrNative(insideBufferHost);
+    Points pointsAcc;
+    pointsAcc.x = mem::view::getPtrNative(xBufferAcc);
+    pointsAcc.y = mem::view::getPtrNative(yBufferAcc);
+    pointsAcc.inside = mem::view::getPtrNative(insideBufferAcc);
+
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        pointsHost.x[idx] = distribution(generator);
+        pointsHost.y[idx] = distribution(generator);
+    }
+
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    mem::view::copy(queue, xBufferAcc, xBufferHost, bufferExtent);
+    mem::view::copy(queue, yBufferAcc, yBufferHost, bufferExtent);
+
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = 1024;
+    uint32_t blocksPerGrid = (n + elementsPerThread - 1) / elementsPerThread;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+    PixelFinderKernelMultiplePointsPerThreadElements pixelFinderKernel;
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, pixelFinderKernel, pointsAcc, r, n);
+    queue::enqueue(queue, taskRunKernel);
+
+    mem::view::copy(queue, insideBufferHost, insideBufferAcc, bufferExtent);
+    alpaka::wait::wait(queue);
+
+    uint32_t P = 0;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (pointsHost.inside[i])
+            ++P;
+    }
+    return 4.f * P / n;
+}
+
+int main() {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    // Select the first device available on a system, for the chosen accelerator
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+
+    // Sequence of estimations with pseudo-randomly varying numbers of points
+    std::vector<uint32_t> numPoints;
+    for (uint32_t iteration = 0; iteration < 32; iteration++)
+        numPoints.push_back(100000u + (iteration * 7919u) % 8u * 250000u);
+    float r = 10.0f;
+    std::mt19937 generator{2020};
+
+    // Reference: allocate all buffers anew for every estimation
+    auto allocStart = std::chrono::steady_clock::now();
+    for (auto n : numPoints)
+    {
+        vec::Vec<Dim, Idx> bufferExtent{n};
+        auto xBufferHost = mem::buf::alloc<float, Idx>(devHost, bufferExtent);
+        auto yBufferHost = mem::buf::alloc<float, Idx>(devHost, bufferExtent);
+        auto insideBufferHost = mem::buf::alloc<bool, Idx>(devHost, bufferExtent);
+        auto xBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+        auto yBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+        auto insideBufferAcc = mem::buf::alloc<bool, Idx>(device, bufferExtent);
+        estimatePi<Acc>(queue, xBufferHost, yBufferHost, insideBufferHost, xBufferAcc, yBufferAcc, insideBufferAcc,
+            n, r, generator);
+    }
+    std::chrono::duration<double, std::milli> allocDuration = std::chrono::steady_clock::now() - allocStart;
+
+    // Take all buffers from the pools, one pool per device and element type
+    BufferPool<float, Idx, dev::DevCpu> floatPoolHost{devHost};
+    BufferPool<bool, Idx, dev::DevCpu> boolPoolHost{devHost};
+    BufferPool<float, Idx, dev::Dev<Acc>> floatPoolAcc{device};
+    BufferPool<bool, Idx, dev::Dev<Acc>> boolPoolAcc{device};
+    float piSum = 0.0f;
+    auto poolStart = std::chrono::steady_clock::now();
+    for (auto n : numPoints)
+    {
+        auto xBufferHost = floatPoolHost.acquire(n);
+        auto yBufferHost = floatPoolHost.acquire(n);
+        auto insideBufferHost = boolPoolHost.acquire(n);
+        auto xBufferAcc = floatPoolAcc.acquire(n);
+        auto yBufferAcc = floatPoolAcc.acquire(n);
+        auto insideBufferAcc = boolPoolAcc.acquire(n);
+        piSum += estimatePi<Acc>(queue, xBufferHost.getBuf(), yBufferHost.getBuf(), insideBufferHost.getBuf(),
+            xBufferAcc.getBuf(), yBufferAcc.getBuf(), insideBufferAcc.getBuf(), n, r, generator);
+        // The buffers are returned to the pools here
+    }
+    std::chrono::duration<double, std::milli> poolDuration = std::chrono::steady_clock::now() - poolStart;
+
+    // Output results
+    std::cout << "Mean computed pi is " << piSum / numPoints.size() << "\n";
+    std::cout << "Execution time with allocations: " << allocDuration.count() << " ms\n";
+    std::cout << "Execution time with buffer pools: " << poolDuration.count() << " ms\n";
+    auto printStats = [](char const * name, auto const & stats) {
+        std::cout << "    " << name << ": " << stats.numRequests << " requests, hit rate "
+            << 100.0 * stats.getHitRate() << "%, peak " << stats.peakAllocatedBytes / 1024 << " KiB\n";
+    };
+    printStats("host float pool", floatPoolHost.getStats());
+    printStats("host bool pool", boolPoolHost.getStats());
+    printStats("device float pool", floatPoolAcc.getStats());
+    printStats("device bool pool", boolPoolAcc.getStats());
+    std::cout << std::flush;
+
+    return 0;
+}
@@ -0,0 +1,400 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <sched.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// This example co-schedules several accelerators of different back-ends in one run.
+// The points are processed in batches, and each batch is partitioned among the workers,
+// each an accelerator instance with its own non-blocking queue:
+// - main: the first enabled parallel back-end, on all but the last CPU of the process;
+// - tail: the serial back-end, on the last CPU, reserved for it.
+// The queues run concurrently, and after each batch the shares of the workers are rebalanced
+// in proportion to their throughput measured in that batch, smoothed over the batches.
+// The throughput of the co-scheduled run is compared to the main worker alone.
+
+// Kernel from the homework with striding and loop blocking, which counts the points inside
+struct CountInsideKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, float const * x, float const * y, float r, uint32_t n,
+        uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float d = math::sqrt(acc, x[i] * x[i] + y[i] * y[i]);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Accelerator instance taking a part of each batch, independent of its back-end
+class Worker {
+public:
+    virtual ~Worker() = default;
+
+    virtual std::string getName() const = 0;
+
+    // Enqueue counting the points inside of n points, without waiting for it
+    virtual void enqueue(float const * x, float const * y, uint32_t n, float r) = 0;
+
+    // Wait for the part enqueued last, return its number of points inside
+    // and the time from enqueuing until it was done in seconds
+    virtual uint32_t wait(double & seconds) = 0;
+};
+
+template<typename Acc>
+class AccWorker : public Worker {
+public:
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using Queue = alpaka::queue::Queue<Acc, alpaka::queue::NonBlocking>;
+
+    // Buffers hold up to capacity points. The thread of the queue, which runs the kernels,
+    // is pinned to cpus, unless it is empty, and so are OpenMP threads started by it.
+    AccWorker(std::string const & role, uint32_t capacity, std::vector<int> const & cpus)
+        : m_name(role + " (" + alpaka::acc::getAccName<Acc>() + ")"), m_device(alpaka::pltf::getDevByIdx<Acc>(0u)),
+          m_devHost(alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u)), m_queue(m_device),
+          m_xBuffer(alpaka::mem::buf::alloc<float, Idx>(m_device, alpaka::vec::Vec<Dim, Idx>{capacity})),
+          m_yBuffer(alpaka::mem::buf::alloc<float, Idx>(m_device, alpaka::vec::Vec<Dim, Idx>{capacity})),
+          m_countBuffer(alpaka::mem::buf::alloc<uint32_t, Idx>(m_device, alpaka::vec::Vec<Dim, Idx>{1u})),
+          m_countBufferHost(alpaka::mem::buf::alloc<uint32_t, Idx>(m_devHost, alpaka::vec::Vec<Dim, Idx>{1u}))
+    {
+        using namespace alpaka;
+        if (!cpus.empty())
+        {
+            auto pinTask = [cpus]() {
+                cpu_set_t mask;
+                CPU_ZERO(&mask);
+                for (int cpu : cpus)
+                    CPU_SET(cpu, &mask);
+                sched_setaffinity(0, sizeof(mask), &mask);
+#if defined(_OPENMP)
+                // The default number of threads stems from all CPUs of the process
+                omp_set_num_threads(static_cast<int>(cpus.size()));
+#endif
+            };
+            queue::enqueue(m_queue, pinTask);
+        }
+        // Use several threads per block where the back-end allows it
+        auto const devProps = acc::getAccDevProps<Acc>(m_device);
+        m_threadsPerBlock = std::min(static_cast<uint32_t>(devProps.m_blockThreadExtentMax[0]), 16u);
+    }
+
+    std::string getName() const override
+    {
+        return m_name;
+    }
+
+    void enqueue(float const * x, float const * y, uint32_t n, float r) override
+    {
+        using namespace alpaka;
+        m_start = std::chrono::steady_clock::now();
+        if (n == 0)
+        {
+            *mem::view::getPtrNative(m_countBufferHost) = 0;
+            m_finish = m_start;
+            return;
+        }
+        vec::Vec<Dim, Idx> extent{n};
+        vec::Vec<Dim, Idx> countExtent{1u};
+        using HostView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>;
+        HostView xView(const_cast<float *>(x), m_devHost, extent);
+        HostView yView(const_cast<float *>(y), m_devHost, extent);
+        mem::view::copy(m_queue, m_xBuffer, xView, extent);
+        mem::view::copy(m_queue, m_yBuffer, yView, extent);
+        mem::view::set(m_queue, m_countBuffer, 0u, countExtent);
+        uint32_t elementsPerThread = 64;
+        uint32_t pointsPerBlock = m_threadsPerBlock * elementsPerThread;
+        uint32_t blocksPerGrid = (n + pointsPerBlock - 1) / pointsPerBlock;
+        auto workDiv = workdiv::WorkDivMembers<Dim, Idx>{blocksPerGrid, m_threadsPerBlock, elementsPerThread};
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, CountInsideKernel{},
+            mem::view::getPtrNative(m_xBuffer), mem::view::getPtrNative(m_yBuffer), r, n,
+            mem::view::getPtrNative(m_countBuffer));
+        queue::enqueue(m_queue, taskRunKernel);
+        mem::view::copy(m_queue, m_countBufferHost, m_countBuffer, countExtent);
+        // Record when the queue is done, the host may notice it later
+        auto * finish = &m_finish;
+        queue::enqueue(m_queue, [finish]() { *finish = std::chrono::steady_clock::now(); });
+    }
+
+    uint32_t wait(double & seconds) override
+    {
+        alpaka::wait::wait(m_queue);
+        seconds = std::chrono::duration<double>(m_finish - m_start).count();
+        return *alpaka::mem::view::getPtrNative(m_countBufferHost);
+    }
+
+private:
+    using BufAccFloat = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, float, Dim, Idx>;
+    using BufAccCount = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, uint32_t, Dim, Idx>;
+    using BufHostCount = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, uint32_t, Dim, Idx>;
+
+    std::string m_name;
+    alpaka::dev::Dev<Acc> m_device;
+    alpaka::dev::DevCpu m_devHost;
+    Queue m_queue;
+    uint32_t m_threadsPerBlock;
+    BufAccFloat m_xBuffer;
+    BufAccFloat m_yBuffer;
+    BufAccCount m_countBuffer;
+    BufHostCount m_countBufferHost;
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::steady_clock::time_point m_finish;
+};
+
+// Create the worker with the first enabled parallel back-end, or nullptr if there is none
+std::unique_ptr<Worker> createMainWorker(uint32_t capacity, std::vector<int> const & cpus)
+{
+    using namespace alpaka;
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    return std::unique_ptr<Worker>(new AccWorker<acc::AccCpuOmp2Blocks<Dim, Idx>>("main", capacity, cpus));
+#elif defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    return std::unique_ptr<Worker>(new AccWorker<acc::AccCpuTbbBlocks<Dim, Idx>>("main", capacity, cpus));
+#elif defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    return std::unique_ptr<Worker>(new AccWorker<acc::AccCpuThreads<Dim, Idx>>("main", capacity, cpus));
+#else
+    (void)capacity;
+    (void)cpus;
+    return nullptr;
+#endif
+}
+
+// Create the worker with the serial back-end, or nullptr if it is not enabled
+std::unique_ptr<Worker> createTailWorker(uint32_t capacity, std::vector<int> const & cpus)
+{
+    using namespace alpaka;
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    return std::unique_ptr<Worker>(new AccWorker<acc::AccCpuSerial<Dim, Idx>>("tail", capacity, cpus));
+#else
+    (void)capacity;
+    (void)cpus;
+    return nullptr;
+#endif
+}
+
+// All logical CPUs the process may run on
+std::vector<int> getAllowedCpus()
+{
+    std::vector<int> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    sched_getaffinity(0, sizeof(mask), &mask);
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &mask))
+            cpus.push_back(cpu);
+    return cpus;
+}
+
+// Result of processing all points
+struct RunResult {
+    uint64_t P = 0;
+    double seconds = 0.0;
+    // Per worker, the points processed and the time busy with them
+    std::vector<uint64_t> numPoints;
+    std::vector<double> busySeconds;
+    // Per batch, the shares of the workers in percent, for the first batches
+    std::vector<std::vector<double>> batchShares;
+};
+
+// Process the points in batches partitioned among the workers by their shares,
+// and rebalance the shares after each batch if rebalance is set
+RunResult run(std::vector<Worker *> const & workers, float const * x, float const * y, uint32_t n, float r,
+    uint32_t batchSize, bool rebalance)
+{
+    // Every worker keeps a small share, so that its throughput is still measured
+    double const minShare = 0.01;
+    // Weight of the throughput of the last batch in the smoothed shares
+    double const smoothing = 0.5;
+    uint32_t const numRecordedBatches = 4;
+    std::size_t const numWorkers = workers.size();
+    std::vector<double> shares(numWorkers, 1.0 / numWorkers);
+    std::vector<uint32_t> parts(numWorkers);
+    RunResult result;
+    result.numPoints.assign(numWorkers, 0);
+    result.busySeconds.assign(numWorkers, 0.0);
+
+    auto start = std::chrono::steady_clock::now();
+    uint32_t batch = 0;
+    for (uint32_t first = 0; first < n; first += batchSize, batch++)
+    {
+        uint32_t batchPoints = std::min(batchSize, n - first);
+        // The last worker takes the remainder of the batch
+        uint32_t offset = first;
+        for (std::size_t worker = 0; worker < numWorkers; worker++)
+        {
+            parts[worker] = (worker + 1 < numWorkers)
+                ? std::min(static_cast<uint32_t>(shares[worker] * batchPoints), first + batchPoints - offset)
+                : first + batchPoints - offset;
+            workers[worker]->enqueue(x + offset, y + offset, parts[worker], r);
+            offset += parts[worker];
+        }
+
+        std::vector<double> throughputs(numWorkers);
+        double totalThroughput = 0.0;
+        for (std::size_t worker = 0; worker < numWorkers; worker++)
+        {
+            double seconds = 0.0;
+            result.P += workers[worker]->wait(seconds);
+            result.numPoints[worker] += parts[worker];
+            result.busySeconds[worker] += seconds;
+            throughputs[worker] = (seconds > 0.0) ? parts[worker] / seconds : 0.0;
+            totalThroughput += throughputs[worker];
+        }
+        if (batch < numRecordedBatches)
+        {
+            result.batchShares.emplace_back();
+            for (std::size_t worker = 0; worker < numWorkers; worker++)
+                result.batchShares.back().push_back(100.0 * parts[worker] / batchPoints);
+        }
+        if (!rebalance || totalThroughput <= 0.0)
+            continue;
+        double totalShare = 0.0;
+        for (std::size_t worker = 0; worker < numWorkers; worker++)
+        {
+            double measuredShare = std::max(throughputs[worker] / totalThroughput, minShare);
+            shares[worker] = (1.0 - smoothing) * shares[worker] + smoothing * measuredShare;
+            totalShare += shares[worker];
+        }
+        for (auto & share : shares)
+            share /= totalShare;
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void printResult(std::string const & title, std::vector<Worker *> const & workers, RunResult const & result,
+    uint32_t n)
+{
+    std::cout << title << ": computed pi is " << 4.0 * result.P / n << ", " << result.seconds * 1e3 << " ms, "
+        << n / result.seconds * 1e-6 << " Mpoints/s\n";
+    for (std::size_t worker = 0; worker < workers.size(); worker++)
+    {
+        double share = 100.0 * result.numPoints[worker] / n;
+        double throughput = (result.busySeconds[worker] > 0.0)
+            ? result.numPoints[worker] / result.busySeconds[worker] * 1e-6
+            : 0.0;
+        std::cout << "    " << std::setw(32) << std::left << workers[worker]->getName() << std::right
+            << std::setw(10) << share << "% of points, " << std::setw(10) << throughput << " Mpoints/s\n";
+    }
+    if (workers.size() > 1)
+    {
+        for (std::size_t batch = 0; batch < result.batchShares.size(); batch++)
+        {
+            std::cout << "    shares of batch " << batch << ":";
+            for (double share : result.batchShares[batch])
+                std::cout << " " << std::setw(10) << share << "%";
+            std::cout << "\n";
+        }
+    }
+    std::cout << std::flush;
+}
+
+// Usage: computePi_heterogeneous [n] [batchSize]
+int main(int argc, char * argv[]) {
+    // Number of points, batch size and circle radius
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000000;
+    uint32_t batchSize = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 4000000;
+    float r = 10.0f;
+    if (n == 0 || batchSize == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [n] [batchSize], with n, batchSize > 0\n";
+        return 1;
+    }
+    batchSize = std::min(batchSize, n);
+
+    // The last CPU is reserved for the tail worker, if there are at least two
+    std::vector<int> mainCpus = getAllowedCpus();
+    std::vector<int> tailCpus;
+    if (mainCpus.size() > 1)
+    {
+        tailCpus.push_back(mainCpus.back());
+        mainCpus.pop_back();
+    }
+    auto mainWorker = createMainWorker(batchSize, mainCpus);
+    auto tailWorker = createTailWorker(batchSize, tailCpus);
+    if (!mainWorker)
+    {
+        std::cerr << "A parallel CPU back-end has to be enabled\n";
+        return 1;
+    }
+
+    // Generate input x, y randomly in [0, r] once, for all runs
+    std::random_device rd;
+    std::mt19937 generator{rd()};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        x[idx] = distribution(generator);
+        y[idx] = distribution(generator);
+    }
+
+    // The first batches also warm up the workers, their buffers and thread pools
+    std::vector<Worker *> mainOnly{mainWorker.get()};
+    run(mainOnly, x.data(), y.data(), batchSize, r, batchSize, false);
+    auto mainResult = run(mainOnly, x.data(), y.data(), n, r, batchSize, false);
+    printResult("Main worker alone", mainOnly, mainResult, n);
+    if (!tailWorker)
+    {
+        std::cout << "The serial back-end is not enabled, there is nothing to co-schedule" << std::endl;
+        return 0;
+    }
+
+    std::vector<Worker *> allWorkers{mainWorker.get(), tailWorker.get()};
+    std::cout << "Co-scheduled, main on " << mainCpus.size() << " CPUs, tail on "
+        << (tailCpus.empty() ? "no reserved CPU" : "CPU " + std::to_string(tailCpus.front())) << "\n";
+    auto staticResult = run(allWorkers, x.data(), y.data(), n, r, batchSize, false);
+    printResult("Co-scheduled with equal shares", allWorkers, staticResult, n);
+    auto dynamicResult = run(allWorkers, x.data(), y.data(), n, r, batchSize, true);
+    printResult("Co-scheduled with rebalanced shares", allWorkers, dynamicResult, n);
+    std::cout << "Speedup of rebalanced co-scheduling over the main worker alone: "
+        << mainResult.seconds / dynamicResult.seconds << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,332 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// This example extends the classification of points with a histogram of
+// the distance d = sqrt(x * x + y * y) to the origin.
+// The same histogram is computed with three strategies of increasing privatization,
+// which differ in the contention on atomic operations:
+// - global atomics: every point increments a bin in global memory;
+// - block-private: each block accumulates a histogram in shared memory
+//   and merges it with global atomics at the end;
+// - thread-private: each thread accumulates a histogram in its local memory
+//   and merges it with global atomics at the end.
+// All strategies are benchmarked on every enabled CPU back-end.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel
+struct Points {
+    float * x;
+    float * y;
+    bool * inside;
+};
+
+// Histogram of distances, numBins bins of width binWidth starting at 0
+struct Histogram {
+    uint32_t * counts;
+    uint32_t numBins;
+    float binWidth;
+};
+
+// Maximum number of bins supported by the privatized strategies
+constexpr uint32_t maxBins = 128;
+
+// processPoint() from the homework, extended to also return the histogram bin of the point.
+// Distances beyond the last bin are attributed to it.
+template<typename Acc>
+ALPAKA_FN_ACC uint32_t processPoint(Acc const & acc, Points points, float r, Histogram histogram, uint32_t idx)
+{
+    using namespace alpaka;
+    float x = points.x[idx];
+    float y = points.y[idx];
+    float d = math::sqrt(acc, x * x + y * y);
+    bool isInside = (d <= r);
+    points.inside[idx] = isInside;
+    uint32_t bin = static_cast<uint32_t>(d / histogram.binWidth);
+    return (bin < histogram.numBins) ? bin : histogram.numBins - 1;
+}
+
+// Every point increments its bin in global memory
+struct HistogramKernelGlobalAtomics {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, Histogram histogram, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                uint32_t bin = processPoint(acc, points, r, histogram, i);
+                atomic::atomicOp<atomic::op::Add>(acc, &histogram.counts[bin], 1u);
+            }
+        }
+    }
+};
+
+// Block shared memory for the block-private histogram
+struct BlockHistogram {
+    uint32_t counts[maxBins];
+};
+
+// Each block accumulates a private histogram in shared memory
+struct HistogramKernelBlockPrivate {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, Histogram histogram, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+        uint32_t blockThreadIdx = idx::getIdx<Block, Threads>(acc)[0];
+        uint32_t blockThreadExtent = workdiv::getWorkDiv<Block, Threads>(acc)[0];
+
+        auto & blockHistogram = block::shared::st::allocVar<BlockHistogram, __COUNTER__>(acc);
+        for (uint32_t bin = blockThreadIdx; bin < histogram.numBins; bin += blockThreadExtent)
+            blockHistogram.counts[bin] = 0;
+        block::sync::syncBlockThreads(acc);
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                uint32_t bin = processPoint(acc, points, r, histogram, i);
+                atomic::atomicOp<atomic::op::Add>(acc, &blockHistogram.counts[bin], 1u, hierarchy::Threads{});
+            }
+        }
+        block::sync::syncBlockThreads(acc);
+
+        for (uint32_t bin = blockThreadIdx; bin < histogram.numBins; bin += blockThreadExtent)
+            if (blockHistogram.counts[bin])
+                atomic::atomicOp<atomic::op::Add>(acc, &histogram.counts[bin], blockHistogram.counts[bin]);
+    }
+};
+
+// Each thread accumulates a private histogram without any atomics
+struct HistogramKernelThreadPrivate {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, Histogram histogram, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCounts[maxBins];
+        for (uint32_t bin = 0; bin < histogram.numBins; bin++)
+            threadCounts[bin] = 0;
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+                ++threadCounts[processPoint(acc, points, r, histogram, i)];
+        }
+
+        for (uint32_t bin = 0; bin < histogram.numBins; bin++)
+            if (threadCounts[bin])
+                atomic::atomicOp<atomic::op::Add>(acc, &histogram.counts[bin], threadCounts[bin]);
+    }
+};
+
+// Run the kernel the given number of times and return the best time in ms,
+// the histogram of the last run is copied to histogramBufferHost
+template<typename Acc, typename Kernel, typename Queue, typename WorkDiv, typename BufHost, typename BufAcc>
+double benchmarkKernel(Queue & queue, WorkDiv const & workDiv, Kernel const & kernelFnObj, Points pointsAcc, float r,
+    Histogram histogramAcc, uint32_t n, BufHost & histogramBufferHost, BufAcc & histogramBufferAcc,
+    uint32_t numRepetitions)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+    vec::Vec<Dim, Idx> histogramExtent{histogramAcc.numBins};
+    double bestDuration = 0.0;
+    for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+    {
+        mem::view::set(queue, histogramBufferAcc, 0u, histogramExtent);
+        alpaka::wait::wait(queue);
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, kernelFnObj, pointsAcc, r, histogramAcc, n);
+        auto start = std::chrono::steady_clock::now();
+        queue::enqueue(queue, taskRunKernel);
+        alpaka::wait::wait(queue);
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        if (repetition == 0 || duration.count() < bestDuration)
+            bestDuration = duration.count();
+    }
+    mem::view::copy(queue, histogramBufferHost, histogramBufferAcc, histogramExtent);
+    alpaka::wait::wait(queue);
+    return bestDuration;
+}
+
+// Benchmark all strategies on the given accelerator type, return false on mismatching results
+template<typename Acc>
+bool benchmarkBackEnd(float const * xHost, float const * yHost, uint32_t n, float r, uint32_t numBins)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    vec::Vec<Dim, Idx> histogramExtent{numBins};
+    auto xBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto yBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto insideBufferAcc = mem::buf::alloc<bool, Idx>(device, bufferExtent);
+    auto insideBufferHost = mem::buf::alloc<bool, Idx>(devHost, bufferExtent);
+    auto histogramBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, histogramExtent);
+    auto histogramBufferHost = mem::buf::alloc<uint32_t, Idx>(devHost, histogramExtent);
+
+    auto xView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>(const_cast<float *>(xHost), devHost, bufferExtent);
+    auto yView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>(const_cast<float *>(yHost), devHost, bufferExtent);
+    mem::view::copy(queue, xBufferAcc, xView, bufferExtent);
+    mem::view::copy(queue, yBufferAcc, yView, bufferExtent);
+
+    Points pointsAcc;
+    pointsAcc.x = mem::view::getPtrNative(xBufferAcc);
+    pointsAcc.y = mem::view::getPtrNative(yBufferAcc);
+    pointsAcc.inside = mem::view::getPtrNative(insideBufferAcc);
+    Histogram histogramAcc;
+    histogramAcc.counts = mem::view::getPtrNative(histogramBufferAcc);
+    histogramAcc.numBins = numBins;
+    histogramAcc.binWidth = r * std::sqrt(2.0f) / numBins;
+
+    // Use several threads per block where the back-end allows it
+    auto const devProps = acc::getAccDevProps<Acc>(device);
+    uint32_t threadsPerBlock = std::min(static_cast<uint32_t>(devProps.m_blockThreadExtentMax[0]), 16u);
+    uint32_t elementsPerThread = 64;
+    uint32_t pointsPerBlock = threadsPerBlock * elementsPerThread;
+    uint32_t blocksPerGrid = (n + pointsPerBlock - 1) / pointsPerBlock;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    uint32_t const numRepetitions = 5;
+    std::vector<std::string> strategies = {"global atomics", "block-private", "thread-private"};
+    std::vector<double> durations;
+    std::vector<std::vector<uint32_t>> histograms;
+    uint32_t const * histogramHost = mem::view::getPtrNative(histogramBufferHost);
+    durations.push_back(benchmarkKernel<Acc>(queue, workDiv, HistogramKernelGlobalAtomics{}, pointsAcc, r,
+        histogramAcc, n, histogramBufferHost, histogramBufferAcc, numRepetitions));
+    histograms.emplace_back(histogramHost, histogramHost + numBins);
+    durations.push_back(benchmarkKernel<Acc>(queue, workDiv, HistogramKernelBlockPrivate{}, pointsAcc, r,
+        histogramAcc, n, histogramBufferHost, histogramBufferAcc, numRepetitions));
+    histograms.emplace_back(histogramHost, histogramHost + numBins);
+    durations.push_back(benchmarkKernel<Acc>(queue, workDiv, HistogramKernelThreadPrivate{}, pointsAcc, r,
+        histogramAcc, n, histogramBufferHost, histogramBufferAcc, numRepetitions));
+    histograms.emplace_back(histogramHost, histogramHost + numBins);
+
+    // Compute Pi on host from the inside flags of the last run
+    mem::view::copy(queue, insideBufferHost, insideBufferAcc, bufferExtent);
+    alpaka::wait::wait(queue);
+    bool const * inside = mem::view::getPtrNative(insideBufferHost);
+    uint32_t P = 0;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (inside[i])
+            ++P;
+    }
+    float pi = 4.f * P / n;
+
+    // Output results
+    bool isConsistent = (histograms[1] == histograms[0]) && (histograms[2] == histograms[0]);
+    std::cout << acc::getAccName<Acc>() << ", " << threadsPerBlock << " threads per block: computed pi is " << pi
+        << (isConsistent ? "" : ", HISTOGRAMS MISMATCH") << "\n";
+    for (std::size_t strategy = 0; strategy < strategies.size(); strategy++)
+        std::cout << "    " << std::setw(16) << std::left << strategies[strategy] << std::right << std::setw(10)
+            << durations[strategy] << " ms, " << n / durations[strategy] * 1e-3 << " Mpoints/s\n";
+    std::cout << std::flush;
+    return isConsistent;
+}
+
+int main() {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Number of points, circle radius and number of histogram bins
+    uint32_t n = 10000000;
+    float r = 10.0f;
+    uint32_t numBins = 64;
+    if (numBins > maxBins)
+    {
+        std::cerr << "At most " << maxBins << " bins are supported\n";
+        return 1;
+    }
+
+    // Generate input x, y randomly in [0, r] once, for all back-ends
+    std::random_device rd;
+    std::mt19937 generator{rd()};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        x[idx] = distribution(generator);
+        y[idx] = distribution(generator);
+    }
+
+    bool isConsistent = true;
+    uint32_t numBackEnds = 0;
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuSerial<Dim, Idx>>(x.data(), y.data(), n, r, numBins);
+    numBackEnds++;
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuOmp2Blocks<Dim, Idx>>(x.data(), y.data(), n, r, numBins);
+    numBackEnds++;
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuOmp2Threads<Dim, Idx>>(x.data(), y.data(), n, r, numBins);
+    numBackEnds++;
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuThreads<Dim, Idx>>(x.data(), y.data(), n, r, numBins);
+    numBackEnds++;
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuTbbBlocks<Dim, Idx>>(x.data(), y.data(), n, r, numBins);
+    numBackEnds++;
+#endif
+
+    if (numBackEnds == 0)
+    {
+        std::cerr << "No CPU back-end is enabled, enable at least one in the alpaka configuration\n";
+        return 1;
+    }
+    return isConsistent ? 0 : 1;
+}
@@ -0,0 +1,244 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostMemory.hpp"
+
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// This example compares the throughput of the strided PixelFinder kernel
+// with the points stored in regular pages and in huge pages.
+// With the strided access pattern neighboring threads touch different pages,
+// so for large numbers of points the kernel suffers from TLB misses with regular pages.
+// Memory is allocated with HostMemory, which falls back to smaller pages
+// when the requested ones are not available.
+// For CPU accelerators the host memory is used by the kernel directly.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel
+struct Points {
+    float * x;
+    float * y;
+    bool * inside;
+};
+
+// Kernel from the homework with the strided loop over points
+struct PixelFinderKernelMultiplePointsPerThread {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+
+        for (uint32_t idx = gridThreadIdx; idx < n; idx += gridThreadExtent)
+        {
+            float x = points.x[idx];
+            float y = points.y[idx];
+            float d = math::sqrt(acc, x * x + y * y);
+            points.inside[idx] = (d <= r);
+        }
+    }
+};
+
+// Counter of data TLB load misses in user space, summed over all threads
+// of the process which exist when the measurement starts.
+// Requires perf events to be permitted, see /proc/sys/kernel/perf_event_paranoid.
+class TlbMissCounter {
+public:
+    ~TlbMissCounter()
+    {
+        closeAll();
+    }
+
+    // Start counting, return false if perf events are not available
+    bool start()
+    {
+        closeAll();
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        DIR * tasks = opendir("/proc/self/task");
+        if (!tasks)
+            return false;
+        while (dirent * entry = readdir(tasks))
+        {
+            if (entry->d_name[0] == '.')
+                continue;
+            pid_t tid = static_cast<pid_t>(std::atoi(entry->d_name));
+            long fd = syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0);
+            if (fd >= 0)
+                m_fds.push_back(static_cast<int>(fd));
+        }
+        closedir(tasks);
+        for (int fd : m_fds)
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        return !m_fds.empty();
+    }
+
+    // Stop counting and return the number of misses, -1 if not available
+    long long stop()
+    {
+        if (m_fds.empty())
+            return -1;
+        long long total = 0;
+        for (int fd : m_fds)
+        {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            long long count = 0;
+            if (read(fd, &count, sizeof(count)) == sizeof(count))
+                total += count;
+        }
+        closeAll();
+        return total;
+    }
+
+private:
+    void closeAll()
+    {
+        for (int fd : m_fds)
+            close(fd);
+        m_fds.clear();
+    }
+
+    std::vector<int> m_fds;
+};
+
+// Usage: computePi_hugePages [n]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+    static_assert(std::is_same<dev::Dev<Acc>, dev::DevCpu>::value,
+        "The kernel works on host memory directly, so a CPU accelerator is required");
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Number of points and circle radius
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : (1u << 26);
+    float r = 10.0f;
+
+    // Many threads, each jumping over the whole grid extent between points
+    uint32_t blocksPerGrid = 1024;
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = 1;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+    PixelFinderKernelMultiplePointsPerThread pixelFinderKernel;
+
+    std::cout << "Points: " << n << ", " << (n * (2 * sizeof(float) + sizeof(bool))) / (1024 * 1024) << " MiB\n";
+    for (PageKind requestedKind :
+        {PageKind::Regular, PageKind::TransparentHuge, PageKind::HugeTlb2M, PageKind::HugeTlb1G})
+    {
+        auto xMemory = HostMemory::allocate(n * sizeof(float), requestedKind);
+        auto yMemory = HostMemory::allocate(n * sizeof(float), requestedKind);
+        auto insideMemory = HostMemory::allocate(n * sizeof(bool), requestedKind);
+        if (!xMemory || !yMemory || !insideMemory)
+        {
+            std::cerr << "Allocation of " << getPageKindName(requestedKind) << " pages failed\n";
+            return 1;
+        }
+        std::cout << "Requested " << getPageKindName(requestedKind) << " pages, got "
+            << getPageKindName(xMemory.getKind()) << " pages\n";
+        if (xMemory.getKind() != requestedKind || yMemory.getKind() != requestedKind
+            || insideMemory.getKind() != requestedKind)
+        {
+            std::cout << "    skipped, as smaller pages are measured already\n";
+            continue;
+        }
+
+        Points points;
+        points.x = xMemory.get<float>();
+        points.y = yMemory.get<float>();
+        points.inside = insideMemory.get<bool>();
+
+        // Generate input x, y randomly in [0, r]
+        std::mt19937 generator{2020};
+        std::uniform_real_distribution<float> distribution(0.0f, r);
+        for (auto idx = 0u; idx < n; idx++)
+        {
+            points.x[idx] = distribution(generator);
+            points.y[idx] = distribution(generator);
+        }
+
+        // Untimed run to fault in the inside buffer and start up the back-end
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, pixelFinderKernel, points, r, n);
+        queue::enqueue(queue, taskRunKernel);
+        alpaka::wait::wait(queue);
+
+        uint32_t numRepetitions = 5;
+        double bestDuration = 0.0;
+        long long tlbMisses = 0;
+        for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+        {
+            TlbMissCounter counter;
+            counter.start();
+            auto start = std::chrono::steady_clock::now();
+            queue::enqueue(queue, taskRunKernel);
+            alpaka::wait::wait(queue);
+            std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+            long long misses = counter.stop();
+            tlbMisses = (misses < 0 || tlbMisses < 0) ? -1 : tlbMisses + misses;
+            if (repetition == 0 || duration.count() < bestDuration)
+                bestDuration = duration.count();
+        }
+
+        uint32_t P = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            if (points.inside[i])
+                ++P;
+        }
+        float pi = 4.f * P / n;
+
+        double bytes = static_cast<double>(n) * (2 * sizeof(float) + sizeof(bool));
+        std::cout << "    computed pi is " << pi << ", best time " << bestDuration << " ms, "
+            << bytes / bestDuration * 1e-6 << " GB/s, dTLB load misses per run: ";
+        if (tlbMisses >= 0)
+            std::cout << tlbMisses / numRepetitions << "\n";
+        else
+            std::cout << "not available\n";
+    }
+    std::cout << std::flush;
+
+    return 0;
+}
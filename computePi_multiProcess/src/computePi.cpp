@@ -0,0 +1,281 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostWorkers.hpp"
+
+#include <fcntl.h>
+#include <omp.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// This example shards the estimation over several worker processes, as ranks of a
+// distributed run would do on a single node.
+// The launcher forks the workers, each runs the kernel on a disjoint shard of the sample
+// indices on its own subset of the CPUs, and writes its partial count and timing into
+// a POSIX shared memory segment. The launcher waits for all workers, merges the counts
+// and reports the timing of every shard.
+// A failing or crashing worker only loses its own shard, which is reported.
+// The launcher does not use alpaka itself: thread pools of OpenMP or TBB do not survive fork,
+// so every worker initializes its own runtime after being forked.
+
+// Random numbers are generated on the device, so that each shard uses its own streams
+struct RandomPixelFinderKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, uint32_t seed, uint32_t shard, float r, uint32_t n,
+        uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        // Each thread of each shard uses its own subsequence, shards have less than 2^16 threads
+        auto generator = rand::generator::createDefault(acc, seed, (shard << 16) | gridThreadIdx);
+        auto distribution = rand::distribution::createUniformReal<float>(acc);
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float x = r * distribution(generator);
+                float y = r * distribution(generator);
+                float d = math::sqrt(acc, x * x + y * y);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Result of a shard in the shared memory segment, written by its worker only
+struct ShardResult {
+    uint64_t first;
+    uint32_t n;
+    uint32_t numInside;
+    int32_t firstCpu;
+    int32_t numCpus;
+    // Time for setting up the accelerator and for the kernel, in seconds
+    double setupSeconds;
+    double kernelSeconds;
+    // Set last by the worker, after all other fields
+    std::atomic<uint32_t> isDone;
+};
+
+// Work of a forked worker process, the return value is its exit status
+int runWorker(ShardResult & result, uint32_t shard, uint32_t seed, float r, std::vector<int> const & cpus)
+{
+    using namespace alpaka;
+
+    // Pin the process before the threads of the back-end are started, so they are confined to the CPUs
+    if (!cpus.empty())
+    {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (int cpu : cpus)
+            CPU_SET(cpu, &mask);
+        if (sched_setaffinity(0, sizeof(mask), &mask) != 0)
+            return 1;
+    }
+    // The default number of OpenMP threads may have been taken from the CPUs of the launcher,
+    // use as many threads as the worker has CPUs instead
+    uint32_t const numCpus = getNumHostWorkers();
+    omp_set_num_threads(static_cast<int>(numCpus));
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    auto start = std::chrono::steady_clock::now();
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    auto const devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+    vec::Vec<Dim, Idx> countExtent{1u};
+    auto countBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, countExtent);
+    auto countBufferHost = mem::buf::alloc<uint32_t, Idx>(devHost, countExtent);
+    mem::view::set(queue, countBufferAcc, 0u, countExtent);
+
+    // One block per CPU of the worker, each processing a contiguous range of points
+    uint32_t blocksPerGrid = std::min(numCpus, 1u << 16);
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = (result.n + blocksPerGrid - 1) / blocksPerGrid;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+    std::chrono::duration<double> setupDuration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, RandomPixelFinderKernel{}, seed, shard, r, result.n,
+        mem::view::getPtrNative(countBufferAcc));
+    queue::enqueue(queue, taskRunKernel);
+    mem::view::copy(queue, countBufferHost, countBufferAcc, countExtent);
+    alpaka::wait::wait(queue);
+    std::chrono::duration<double> kernelDuration = std::chrono::steady_clock::now() - start;
+
+    result.numInside = *mem::view::getPtrNative(countBufferHost);
+    result.setupSeconds = setupDuration.count();
+    result.kernelSeconds = kernelDuration.count();
+    result.isDone.store(1, std::memory_order_release);
+    return 0;
+}
+
+// All logical CPUs the process may run on
+std::vector<int> getAllowedCpus()
+{
+    std::vector<int> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    sched_getaffinity(0, sizeof(mask), &mask);
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &mask))
+            cpus.push_back(cpu);
+    return cpus;
+}
+
+// Usage: computePi_multiProcess [numProcesses] [n]
+int main(int argc, char * argv[]) {
+    // Number of worker processes, total number of points and circle radius
+    uint32_t numProcesses = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 4;
+    uint64_t n = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 400000000;
+    float r = 10.0f;
+    uint32_t seed = 42;
+    // The kernel uses 32 bit indices, which must not wrap when striding over the largest shard
+    if (numProcesses == 0 || numProcesses > (1u << 16) || n == 0
+        || (n + numProcesses - 1) / numProcesses > (1ull << 31))
+    {
+        std::cerr << "Usage: " << argv[0] << " [numProcesses] [n], with 1 <= numProcesses <= 65536"
+            << " and at most 2^31 points per process\n";
+        return 1;
+    }
+
+    // The segment is unlinked right after mapping it, the mapping is inherited by the workers.
+    // So it disappears with the processes, even if they are killed.
+    std::string const segmentName = "/computePi_multiProcess." + std::to_string(getpid());
+    std::size_t const segmentBytes = numProcesses * sizeof(ShardResult);
+    int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        std::cerr << "Cannot create shared memory segment " << segmentName << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    void * segment = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(segmentBytes)) == 0)
+        segment = mmap(nullptr, segmentBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int mapError = errno;
+    shm_unlink(segmentName.c_str());
+    close(fd);
+    if (segment == MAP_FAILED)
+    {
+        std::cerr << "Cannot map shared memory segment " << segmentName << ": " << std::strerror(mapError) << "\n";
+        return 1;
+    }
+    // The segment is zero-filled, so the results only need their shards assigned
+    auto * results = static_cast<ShardResult *>(segment);
+
+    // Split the points and the CPUs into contiguous shards
+    std::vector<int> cpus = getAllowedCpus();
+    std::vector<std::vector<int>> shardCpus(numProcesses);
+    for (uint32_t shard = 0; shard < numProcesses; shard++)
+    {
+        uint64_t first = n * shard / numProcesses;
+        results[shard].first = first;
+        results[shard].n = static_cast<uint32_t>(n * (shard + 1) / numProcesses - first);
+        // With more processes than CPUs, the processes share CPUs round-robin
+        std::size_t firstCpu = cpus.size() * shard / numProcesses;
+        std::size_t lastCpu = std::max(cpus.size() * (shard + 1) / numProcesses, firstCpu + 1);
+        shardCpus[shard].assign(cpus.begin() + firstCpu, cpus.begin() + std::min(lastCpu, cpus.size()));
+        results[shard].firstCpu = shardCpus[shard].empty() ? -1 : shardCpus[shard].front();
+        results[shard].numCpus = static_cast<int32_t>(shardCpus[shard].size());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<pid_t> pids(numProcesses, -1);
+    for (uint32_t shard = 0; shard < numProcesses; shard++)
+    {
+        pids[shard] = fork();
+        if (pids[shard] == 0)
+            _exit(runWorker(results[shard], shard, seed, r, shardCpus[shard]));
+        if (pids[shard] < 0)
+            std::cerr << "Cannot fork worker " << shard << ": " << std::strerror(errno) << "\n";
+    }
+    std::vector<int> statuses(numProcesses, -1);
+    for (uint32_t shard = 0; shard < numProcesses; shard++)
+        if (pids[shard] > 0)
+            waitpid(pids[shard], &statuses[shard], 0);
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    // Merge the counts of the shards whose workers finished
+    uint64_t P = 0;
+    uint64_t numMerged = 0;
+    uint32_t numFailed = 0;
+    std::cout << std::setw(6) << "shard" << std::setw(8) << "pid" << std::setw(10) << "CPUs" << std::setw(12)
+        << "points" << std::setw(12) << "setup ms" << std::setw(12) << "kernel ms" << std::setw(14)
+        << "Mpoints/s" << "  status\n";
+    for (uint32_t shard = 0; shard < numProcesses; shard++)
+    {
+        ShardResult const & result = results[shard];
+        int status = statuses[shard];
+        bool isDone = pids[shard] > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0
+            && result.isDone.load(std::memory_order_acquire) == 1;
+        std::string cpuRange = std::to_string(result.firstCpu) + "+" + std::to_string(result.numCpus);
+        std::cout << std::setw(6) << shard << std::setw(8) << pids[shard] << std::setw(10) << cpuRange
+            << std::setw(12) << result.n;
+        if (isDone)
+        {
+            P += result.numInside;
+            numMerged += result.n;
+            std::cout << std::setw(12) << result.setupSeconds * 1e3 << std::setw(12) << result.kernelSeconds * 1e3
+                << std::setw(14) << result.n / result.kernelSeconds * 1e-6 << "  done\n";
+            continue;
+        }
+        numFailed++;
+        std::cout << std::setw(38) << "" << "  failed";
+        if (pids[shard] > 0 && WIFSIGNALED(status))
+            std::cout << ", killed by signal " << WTERMSIG(status);
+        else if (pids[shard] > 0 && WIFEXITED(status))
+            std::cout << ", exit status " << WEXITSTATUS(status);
+        std::cout << "\n";
+    }
+    munmap(segment, segmentBytes);
+
+    // Output results
+    double pi = (numMerged > 0) ? 4.0 * P / numMerged : 0.0;
+    std::cout << "Computed pi is " << pi << " from " << numMerged << " of " << n << " points in " << numProcesses
+        << " processes, " << numFailed << " failed\n";
+    std::cout << "Execution time: " << duration.count() * 1e3 << " ms, " << numMerged / duration.count() * 1e-6
+        << " Mpoints/s" << std::endl;
+
+    return (numFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// This example splits the points into K slices, each processed by its own kernel launch
+// in its own non-blocking queue on the same device, instead of a single launch in a single queue.
+// The queues run concurrently, and the partial counts of the slices are added up on the host
+// after waiting for all queues.
+// For every enabled CPU back-end, the throughput is measured for K = 1, 2, 4, ... up to maxQueues.
+// A single launch may not use all cores, e.g. when the back-end runs the blocks of a grid
+// one after another, then several concurrent launches can make up for it.
+
+// Kernel from the homework with striding and loop blocking, which counts the points inside
+struct CountInsideKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, float const * x, float const * y, float r, uint32_t n,
+        uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float d = math::sqrt(acc, x[i] * x[i] + y[i] * y[i]);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Slice of the points with its own queue and buffers on the device
+template<typename Acc>
+class QueueSlice {
+public:
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using Queue = alpaka::queue::Queue<Acc, alpaka::queue::NonBlocking>;
+
+    // Create the queue and copy the points [first, first + n) of the host arrays to the device
+    QueueSlice(alpaka::dev::Dev<Acc> const & device, float const * xHost, float const * yHost, uint32_t first,
+        uint32_t n)
+        : m_queue(device), m_n(n),
+          m_xBuffer(alpaka::mem::buf::alloc<float, Idx>(device, alpaka::vec::Vec<Dim, Idx>{n})),
+          m_yBuffer(alpaka::mem::buf::alloc<float, Idx>(device, alpaka::vec::Vec<Dim, Idx>{n})),
+          m_countBuffer(alpaka::mem::buf::alloc<uint32_t, Idx>(device, alpaka::vec::Vec<Dim, Idx>{1u})),
+          m_countBufferHost(alpaka::mem::buf::alloc<uint32_t, Idx>(alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u),
+              alpaka::vec::Vec<Dim, Idx>{1u}))
+    {
+        using namespace alpaka;
+        auto const devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+        vec::Vec<Dim, Idx> extent{n};
+        using HostView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>;
+        HostView xView(const_cast<float *>(xHost + first), devHost, extent);
+        HostView yView(const_cast<float *>(yHost + first), devHost, extent);
+        mem::view::copy(m_queue, m_xBuffer, xView, extent);
+        mem::view::copy(m_queue, m_yBuffer, yView, extent);
+        alpaka::wait::wait(m_queue);
+
+        // Use several threads per block where the back-end allows it
+        auto const devProps = acc::getAccDevProps<Acc>(device);
+        m_threadsPerBlock = std::min(static_cast<uint32_t>(devProps.m_blockThreadExtentMax[0]), 16u);
+    }
+
+    // Enqueue counting the points inside, without waiting for it
+    void enqueue(float r)
+    {
+        using namespace alpaka;
+        vec::Vec<Dim, Idx> countExtent{1u};
+        uint32_t elementsPerThread = 64;
+        uint32_t pointsPerBlock = m_threadsPerBlock * elementsPerThread;
+        uint32_t blocksPerGrid = std::max((m_n + pointsPerBlock - 1) / pointsPerBlock, 1u);
+        auto workDiv = workdiv::WorkDivMembers<Dim, Idx>{blocksPerGrid, m_threadsPerBlock, elementsPerThread};
+        mem::view::set(m_queue, m_countBuffer, 0u, countExtent);
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, CountInsideKernel{},
+            mem::view::getPtrNative(m_xBuffer), mem::view::getPtrNative(m_yBuffer), r, m_n,
+            mem::view::getPtrNative(m_countBuffer));
+        queue::enqueue(m_queue, taskRunKernel);
+        mem::view::copy(m_queue, m_countBufferHost, m_countBuffer, countExtent);
+    }
+
+    // Wait for the slice and return its number of points inside
+    uint32_t wait()
+    {
+        alpaka::wait::wait(m_queue);
+        return *alpaka::mem::view::getPtrNative(m_countBufferHost);
+    }
+
+    uint32_t getThreadsPerBlock() const
+    {
+        return m_threadsPerBlock;
+    }
+
+private:
+    using BufAccFloat = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, float, Dim, Idx>;
+    using BufAccCount = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, uint32_t, Dim, Idx>;
+    using BufHostCount = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, uint32_t, Dim, Idx>;
+
+    Queue m_queue;
+    uint32_t m_n;
+    uint32_t m_threadsPerBlock;
+    BufAccFloat m_xBuffer;
+    BufAccFloat m_yBuffer;
+    BufAccCount m_countBuffer;
+    BufHostCount m_countBufferHost;
+};
+
+// Count the points inside with numQueues slices and return the best time in ms of numRepetitions runs
+template<typename Acc>
+double benchmarkQueues(float const * xHost, float const * yHost, uint32_t n, float r, uint32_t numQueues,
+    uint32_t numRepetitions, uint64_t & P)
+{
+    using namespace alpaka;
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    std::vector<QueueSlice<Acc>> slices;
+    slices.reserve(numQueues);
+    for (uint32_t slice = 0; slice < numQueues; slice++)
+    {
+        uint32_t first = static_cast<uint32_t>(static_cast<uint64_t>(n) * slice / numQueues);
+        uint32_t last = static_cast<uint32_t>(static_cast<uint64_t>(n) * (slice + 1) / numQueues);
+        slices.emplace_back(device, xHost, yHost, first, last - first);
+    }
+
+    double bestDuration = 0.0;
+    for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (auto & slice : slices)
+            slice.enqueue(r);
+        // Merge the partial counts after all queues are done
+        P = 0;
+        for (auto & slice : slices)
+            P += slice.wait();
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        if (repetition == 0 || duration.count() < bestDuration)
+            bestDuration = duration.count();
+    }
+    return bestDuration;
+}
+
+// Benchmark 1, 2, 4, ... up to maxQueues queues on the given accelerator type,
+// return false if the counts differ between the numbers of queues
+template<typename Acc>
+bool benchmarkBackEnd(float const * xHost, float const * yHost, uint32_t n, float r, uint32_t maxQueues)
+{
+    using namespace alpaka;
+    uint32_t const numRepetitions = 5;
+    uint64_t referenceP = 0;
+    double referenceDuration = 0.0;
+    bool isConsistent = true;
+    std::cout << acc::getAccName<Acc>() << "\n";
+    for (uint32_t numQueues = 1; numQueues <= maxQueues; numQueues *= 2)
+    {
+        uint64_t P = 0;
+        double duration = benchmarkQueues<Acc>(xHost, yHost, n, r, numQueues, numRepetitions, P);
+        if (numQueues == 1)
+        {
+            referenceP = P;
+            referenceDuration = duration;
+        }
+        isConsistent = isConsistent && (P == referenceP);
+        double pi = 4.0 * P / n;
+        std::cout << "    " << std::setw(3) << numQueues << " queues: " << std::setw(10) << duration << " ms, "
+            << std::setw(10) << n / duration * 1e-3 << " Mpoints/s, speedup " << std::setw(6)
+            << referenceDuration / duration << ", pi " << pi << (P == referenceP ? "" : ", COUNT MISMATCH")
+            << "\n";
+    }
+    std::cout << std::flush;
+    return isConsistent;
+}
+
+// Usage: computePi_multiQueue [n] [maxQueues]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Number of points, circle radius and largest number of queues
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000000;
+    uint32_t maxQueues = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 16;
+    float r = 10.0f;
+    if (n == 0 || maxQueues == 0 || maxQueues > n)
+    {
+        std::cerr << "Usage: " << argv[0] << " [n] [maxQueues], with 1 <= maxQueues <= n\n";
+        return 1;
+    }
+
+    // Generate input x, y randomly in [0, r] once, for all back-ends
+    std::random_device rd;
+    std::mt19937 generator{rd()};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        x[idx] = distribution(generator);
+        y[idx] = distribution(generator);
+    }
+
+    bool isConsistent = true;
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuSerial<Dim, Idx>>(x.data(), y.data(), n, r, maxQueues);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuOmp2Blocks<Dim, Idx>>(x.data(), y.data(), n, r, maxQueues);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuOmp2Threads<Dim, Idx>>(x.data(), y.data(), n, r, maxQueues);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuThreads<Dim, Idx>>(x.data(), y.data(), n, r, maxQueues);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    isConsistent &= benchmarkBackEnd<acc::AccCpuTbbBlocks<Dim, Idx>>(x.data(), y.data(), n, r, maxQueues);
+#endif
+
+    return isConsistent ? 0 : 1;
+}
@@ -0,0 +1,301 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostMemory.hpp"
+#include "hostWorkers.hpp"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// This example compares NUMA placements of the points for a CPU accelerator.
+// Physical pages are assigned on the NUMA node of the thread touching them first.
+// When the host fills the points from one thread, all pages end up on its node,
+// and threads on other sockets have to read them over the interconnect.
+// The placements compared are:
+// - single thread: the host touches all memory first, as in the lessons;
+// - kernel first touch: the memory is first touched by a kernel with the same
+//   work division and index-to-thread mapping as the PixelFinder kernel;
+// - interleaved: pages are distributed round-robin over all nodes;
+// - bound to a node: all pages are on a single node, once for every node, which measures
+//   the bandwidth each node's memory delivers to all threads.
+// The kernel first touch placement only matches when each block is always executed
+// by the same thread on the same core, so threads should be pinned, e.g. OMP_PROC_BIND=true.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel
+struct Points {
+    float * x;
+    float * y;
+    bool * inside;
+};
+
+// Kernel from the homework, with striding and loop blocking
+struct PixelFinderKernelMultiplePointsPerThreadElements {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float r, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float x = points.x[i];
+                float y = points.y[i];
+                float d = math::sqrt(acc, x * x + y * y);
+                points.inside[i] = (d <= r);
+            }
+        }
+    }
+};
+
+// Kernel touching all points with the same index-to-thread mapping as
+// PixelFinderKernelMultiplePointsPerThreadElements, to place their pages
+struct FirstTouchKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                points.x[i] = 0.0f;
+                points.y[i] = 0.0f;
+                points.inside[i] = false;
+            }
+        }
+    }
+};
+
+// Placement strategies of the points
+enum class Placement {
+    SingleThread,
+    KernelFirstTouch,
+    Interleaved,
+    BoundToNode
+};
+
+char const * getPlacementName(Placement placement)
+{
+    switch (placement)
+    {
+    case Placement::SingleThread:
+        return "single thread";
+    case Placement::KernelFirstTouch:
+        return "kernel first touch";
+    case Placement::Interleaved:
+        return "interleaved";
+    case Placement::BoundToNode:
+        return "bound to node";
+    }
+    return "unknown";
+}
+
+// Add the number of pages of the memory on each NUMA node to pagesPerNode,
+// return false if the location of pages cannot be queried
+bool countPagesPerNode(HostMemory const & memory, std::vector<std::size_t> & pagesPerNode)
+{
+    std::size_t const pageBytes = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t const numPages = (memory.getBytes() + pageBytes - 1) / pageBytes;
+    std::size_t const batchSize = 4096;
+    std::vector<void *> pages(batchSize);
+    std::vector<int> status(batchSize);
+    for (std::size_t first = 0; first < numPages; first += batchSize)
+    {
+        std::size_t const count = std::min(batchSize, numPages - first);
+        for (std::size_t page = 0; page < count; page++)
+            pages[page] = memory.get<char>() + (first + page) * pageBytes;
+        // Without target nodes, move_pages only reports the current node of each page
+        if (syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0)
+            return false;
+        for (std::size_t page = 0; page < count; page++)
+        {
+            if (status[page] < 0)
+                continue;
+            if (pagesPerNode.size() <= static_cast<std::size_t>(status[page]))
+                pagesPerNode.resize(status[page] + 1);
+            ++pagesPerNode[status[page]];
+        }
+    }
+    return true;
+}
+
+// Usage: computePi_numa [n]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+    static_assert(std::is_same<dev::Dev<Acc>, dev::DevCpu>::value,
+        "The kernel works on host memory directly, so a CPU accelerator is required");
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Number of points and circle radius
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : (1u << 26);
+    float r = 10.0f;
+
+    // One block per host thread, each processing a contiguous range of points
+    uint32_t blocksPerGrid = getNumHostWorkers();
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = (n + blocksPerGrid - 1) / blocksPerGrid;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    auto const nodes = getNumaNodesWithMemory();
+    std::cout << "NUMA nodes with memory: " << nodes.size() << ", blocks: " << blocksPerGrid
+        << (std::getenv("OMP_PROC_BIND") ? "" : ", OMP_PROC_BIND is not set") << "\n";
+    // Placements to measure with the node for BoundToNode
+    std::vector<std::pair<Placement, int>> placements
+        = {{Placement::SingleThread, 0}, {Placement::KernelFirstTouch, 0}, {Placement::Interleaved, 0}};
+    for (int node : nodes)
+        placements.emplace_back(Placement::BoundToNode, node);
+    for (auto const & entry : placements)
+    {
+        Placement const placement = entry.first;
+        std::string name = getPlacementName(placement);
+        if (placement == Placement::BoundToNode)
+            name += " " + std::to_string(entry.second);
+        auto xMemory = HostMemory::allocate(n * sizeof(float), PageKind::Regular);
+        auto yMemory = HostMemory::allocate(n * sizeof(float), PageKind::Regular);
+        auto insideMemory = HostMemory::allocate(n * sizeof(bool), PageKind::Regular);
+        if (!xMemory || !yMemory || !insideMemory)
+        {
+            std::cerr << "Allocation failed\n";
+            return 1;
+        }
+        Points points;
+        points.x = xMemory.get<float>();
+        points.y = yMemory.get<float>();
+        points.inside = insideMemory.get<bool>();
+
+        // Place the pages, before the host fills in the points
+        if (placement == Placement::SingleThread)
+            std::memset(points.inside, 0, n * sizeof(bool));
+        if (placement == Placement::KernelFirstTouch)
+        {
+            auto taskFirstTouch = kernel::createTaskKernel<Acc>(workDiv, FirstTouchKernel{}, points, n);
+            queue::enqueue(queue, taskFirstTouch);
+            alpaka::wait::wait(queue);
+        }
+        if (placement == Placement::Interleaved)
+        {
+            if (!xMemory.interleave() || !yMemory.interleave() || !insideMemory.interleave())
+            {
+                std::cout << name << ": not supported, skipped\n";
+                continue;
+            }
+            std::memset(points.inside, 0, n * sizeof(bool));
+        }
+        if (placement == Placement::BoundToNode)
+        {
+            if (!xMemory.bindToNode(entry.second) || !yMemory.bindToNode(entry.second)
+                || !insideMemory.bindToNode(entry.second))
+            {
+                std::cout << name << ": not supported, skipped\n";
+                continue;
+            }
+            std::memset(points.inside, 0, n * sizeof(bool));
+        }
+
+        // Generate input x, y randomly in [0, r]
+        std::mt19937 generator{2020};
+        std::uniform_real_distribution<float> distribution(0.0f, r);
+        for (auto idx = 0u; idx < n; idx++)
+        {
+            points.x[idx] = distribution(generator);
+            points.y[idx] = distribution(generator);
+        }
+
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv,
+            PixelFinderKernelMultiplePointsPerThreadElements{}, points, r, n);
+        queue::enqueue(queue, taskRunKernel);
+        alpaka::wait::wait(queue);
+        uint32_t numRepetitions = 5;
+        double bestDuration = 0.0;
+        for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            queue::enqueue(queue, taskRunKernel);
+            alpaka::wait::wait(queue);
+            std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+            if (repetition == 0 || duration.count() < bestDuration)
+                bestDuration = duration.count();
+        }
+
+        uint32_t P = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            if (points.inside[i])
+                ++P;
+        }
+        float pi = 4.f * P / n;
+
+        // Output results with the location of the pages
+        double bandwidth = static_cast<double>(n) * (2 * sizeof(float) + sizeof(bool)) / bestDuration * 1e-6;
+        std::cout << name << ": computed pi is " << pi << ", best time " << bestDuration << " ms, " << bandwidth
+            << " GB/s\n";
+        std::vector<std::size_t> pagesPerNode;
+        if (countPagesPerNode(xMemory, pagesPerNode) && countPagesPerNode(yMemory, pagesPerNode)
+            && countPagesPerNode(insideMemory, pagesPerNode))
+        {
+            std::size_t numPages = 0;
+            for (auto pages : pagesPerNode)
+                numPages += pages;
+            for (std::size_t node = 0; node < pagesPerNode.size(); node++)
+            {
+                double share = numPages ? static_cast<double>(pagesPerNode[node]) / numPages : 0.0;
+                std::cout << "    node " << node << ": " << 100.0 * share << "% of pages\n";
+            }
+        }
+        else
+            std::cout << "    page locations are not available\n";
+    }
+    std::cout << std::flush;
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostMemory.hpp"
+#include "hostWorkers.hpp"
+#include "pipeline.hpp"
+#include "pointDecoding.hpp"
+#include "pointFile.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// This example splits processing a point file into a pipeline of four stages,
+// each running on its own host thread, see pipeline.hpp:
+// - read: read the encoded columns of a chunk from the file with pread;
+// - decode: decode the columns to floats on the host;
+// - classify: copy the floats to the device and count the points inside with a kernel,
+//   in a blocking queue of the stage;
+// - reduce: add up the counts of the chunks.
+// All stages work on different chunks at the same time, so the throughput is given by
+// the slowest stage instead of the sum of all of them.
+// The report shows for each stage how long it was busy and how long it waited for input
+// or for room in the next ring, which tells the stage limiting the throughput.
+
+// Kernel from the homework with striding and loop blocking, which counts the points inside
+struct CountInsideKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, float const * x, float const * y, float r, uint32_t n,
+        uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float d = math::sqrt(acc, x[i] * x[i] + y[i] * y[i]);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Data of a slot of the pipeline, each stage only touches the fields it produces or consumes
+struct Chunk {
+    uint64_t first;
+    uint32_t count;
+    HostMemory encodedX;
+    HostMemory encodedY;
+    HostMemory x;
+    HostMemory y;
+    uint32_t numInside;
+};
+
+// Read bytes bytes at offset, continuing short reads, return false on failure or at the end of the file
+bool readFully(int fd, unsigned char * ptr, std::size_t bytes, uint64_t offset)
+{
+    std::size_t doneBytes = 0;
+    while (doneBytes < bytes)
+    {
+        ssize_t result = pread(fd, ptr + doneBytes, bytes - doneBytes, static_cast<off_t>(offset + doneBytes));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return false;
+        doneBytes += static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+// Classify stage, with device buffers for one chunk, as it processes one chunk at a time
+template<typename Acc>
+class Classifier {
+public:
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using Queue = alpaka::queue::Queue<Acc, alpaka::queue::Blocking>;
+
+    Classifier(uint32_t chunkSize, float r)
+        : m_device(alpaka::pltf::getDevByIdx<Acc>(0u)), m_devHost(alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u)),
+          m_queue(m_device), m_r(r),
+          m_xBuffer(alpaka::mem::buf::alloc<float, Idx>(m_device, alpaka::vec::Vec<Dim, Idx>{chunkSize})),
+          m_yBuffer(alpaka::mem::buf::alloc<float, Idx>(m_device, alpaka::vec::Vec<Dim, Idx>{chunkSize})),
+          m_countBuffer(alpaka::mem::buf::alloc<uint32_t, Idx>(m_device, alpaka::vec::Vec<Dim, Idx>{1u})),
+          m_countBufferHost(alpaka::mem::buf::alloc<uint32_t, Idx>(m_devHost, alpaka::vec::Vec<Dim, Idx>{1u}))
+    {
+        // One block per host thread, each processing a contiguous range of points of a chunk
+        m_blocksPerGrid = getNumHostWorkers();
+    }
+
+    // Return the number of points inside of the decoded chunk
+    uint32_t operator()(Chunk const & chunk)
+    {
+        using namespace alpaka;
+        vec::Vec<Dim, Idx> extent{chunk.count};
+        vec::Vec<Dim, Idx> countExtent{1u};
+        using HostView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>;
+        HostView xView(chunk.x.get<float>(), m_devHost, extent);
+        HostView yView(chunk.y.get<float>(), m_devHost, extent);
+        mem::view::copy(m_queue, m_xBuffer, xView, extent);
+        mem::view::copy(m_queue, m_yBuffer, yView, extent);
+        mem::view::set(m_queue, m_countBuffer, 0u, countExtent);
+        uint32_t elementsPerThread = (chunk.count + m_blocksPerGrid - 1) / m_blocksPerGrid;
+        auto workDiv = workdiv::WorkDivMembers<Dim, Idx>{m_blocksPerGrid, 1u, elementsPerThread};
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, CountInsideKernel{},
+            mem::view::getPtrNative(m_xBuffer), mem::view::getPtrNative(m_yBuffer), m_r, chunk.count,
+            mem::view::getPtrNative(m_countBuffer));
+        queue::enqueue(m_queue, taskRunKernel);
+        mem::view::copy(m_queue, m_countBufferHost, m_countBuffer, countExtent);
+        alpaka::wait::wait(m_queue);
+        return *mem::view::getPtrNative(m_countBufferHost);
+    }
+
+private:
+    using BufAccFloat = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, float, Dim, Idx>;
+    using BufAccCount = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, uint32_t, Dim, Idx>;
+    using BufHostCount = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, uint32_t, Dim, Idx>;
+
+    alpaka::dev::Dev<Acc> m_device;
+    alpaka::dev::DevCpu m_devHost;
+    Queue m_queue;
+    float m_r;
+    uint32_t m_blocksPerGrid;
+    BufAccFloat m_xBuffer;
+    BufAccFloat m_yBuffer;
+    BufAccCount m_countBuffer;
+    BufHostCount m_countBufferHost;
+};
+
+// Usage: computePi_pipeline <file> [pointsPerChunk] [numSlots] [ringCapacity]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <file> [pointsPerChunk] [numSlots] [ringCapacity],"
+            << " files are created with writePoints\n";
+        return 1;
+    }
+    // The file is mapped to validate its header, the read stage reads it with pread
+    auto file = PointFile::open(argv[1]);
+    if (!file)
+    {
+        std::cerr << file.getError() << "\n";
+        return 1;
+    }
+    int fd = open(argv[1], O_RDONLY);
+    if (fd < 0)
+    {
+        std::cerr << "Cannot open " << argv[1] << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    PointFileHeader const header = file.getHeader();
+    uint64_t const n = file.getNumPoints();
+    uint32_t const pointBytes = getPointBytes(header.encoding);
+
+    // Chunks of shuffled files start at chunk boundaries of the file
+    uint32_t chunkAlignment = (header.encoding == PointEncoding::Fixed16Shuffled) ? header.chunkPoints : 1u;
+    uint32_t chunkSize = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : (1u << 20);
+    chunkSize = std::max((chunkSize + chunkAlignment - 1) / chunkAlignment, 1u) * chunkAlignment;
+    uint32_t numSlots = (argc > 3) ? std::max(static_cast<uint32_t>(std::atoi(argv[3])), 1u) : 4u;
+    uint32_t ringCapacity = (argc > 4) ? std::max(static_cast<uint32_t>(std::atoi(argv[4])), 1u) : numSlots;
+
+    std::vector<Chunk> chunks(numSlots);
+    for (auto & chunk : chunks)
+    {
+        chunk.encodedX = HostMemory::allocate(std::size_t{chunkSize} * pointBytes, PageKind::Regular);
+        chunk.encodedY = HostMemory::allocate(std::size_t{chunkSize} * pointBytes, PageKind::Regular);
+        chunk.x = HostMemory::allocate(std::size_t{chunkSize} * sizeof(float), PageKind::Regular);
+        chunk.y = HostMemory::allocate(std::size_t{chunkSize} * sizeof(float), PageKind::Regular);
+        if (!chunk.encodedX || !chunk.encodedY || !chunk.x || !chunk.y)
+        {
+            std::cerr << "Cannot allocate the chunk buffers\n";
+            return 1;
+        }
+    }
+
+    Pipeline pipeline(numSlots, ringCapacity);
+    uint64_t nextFirst = 0;
+    std::atomic<int> readError{0};
+    pipeline.setSource("read", [&](uint32_t slot) {
+        Chunk & chunk = chunks[slot];
+        if (nextFirst >= n)
+            return false;
+        chunk.first = nextFirst;
+        chunk.count = static_cast<uint32_t>(std::min<uint64_t>(chunkSize, n - nextFirst));
+        nextFirst += chunk.count;
+        std::size_t const bytes = std::size_t{chunk.count} * pointBytes;
+        if (!readFully(fd, chunk.encodedX.get<unsigned char>(), bytes, header.xOffset + chunk.first * pointBytes)
+            || !readFully(fd, chunk.encodedY.get<unsigned char>(), bytes, header.yOffset + chunk.first * pointBytes))
+        {
+            readError = (errno != 0) ? errno : EIO;
+            return false;
+        }
+        return true;
+    });
+    pipeline.addStage("decode", [&](uint32_t slot) {
+        Chunk & chunk = chunks[slot];
+        dispatchPointDecoder(header, chunk.count, [&](auto decoder) {
+            unsigned char const * encodedX = chunk.encodedX.get<unsigned char>();
+            unsigned char const * encodedY = chunk.encodedY.get<unsigned char>();
+            float * x = chunk.x.get<float>();
+            float * y = chunk.y.get<float>();
+            for (uint32_t i = 0; i < chunk.count; i++)
+            {
+                x[i] = decoder(encodedX, i);
+                y[i] = decoder(encodedY, i);
+            }
+        });
+    });
+    Classifier<Acc> classifier(chunkSize, header.r);
+    pipeline.addStage("classify", [&](uint32_t slot) {
+        chunks[slot].numInside = classifier(chunks[slot]);
+    });
+    uint64_t P = 0;
+    uint64_t numProcessed = 0;
+    pipeline.addStage("reduce", [&](uint32_t slot) {
+        P += chunks[slot].numInside;
+        numProcessed += chunks[slot].count;
+    });
+
+    double wallSeconds = pipeline.run();
+    close(fd);
+    if (readError != 0)
+    {
+        std::cerr << "Reading " << argv[1] << " failed: " << std::strerror(readError) << "\n";
+        return 1;
+    }
+    double pi = (numProcessed > 0) ? 4.0 * P / numProcessed : 0.0;
+
+    // Output results, throughput refers to the encoded coordinates of the file
+    double bytes = static_cast<double>(n) * 2 * pointBytes;
+    std::cout << "Computed pi is " << pi << " from " << numProcessed << " points encoded as "
+        << getPointEncodingName(header.encoding) << " in chunks of up to " << chunkSize << " points, "
+        << numSlots << " slots, rings of " << ringCapacity << "\n";
+    std::cout << "Execution time: " << wallSeconds << " s, " << bytes / wallSeconds * 1e-9 << " GB/s\n";
+    std::cout << std::left << std::setw(10) << "stage" << std::right << std::setw(8) << "chunks"
+        << std::setw(12) << "busy s" << std::setw(14) << "in stall s" << std::setw(14) << "out stall s"
+        << std::setw(14) << "utilization" << "\n";
+    for (auto const & stats : pipeline.getStats())
+        std::cout << std::left << std::setw(10) << stats.name << std::right << std::setw(8) << stats.numItems
+            << std::setw(12) << stats.busySeconds << std::setw(14) << stats.inputStallSeconds
+            << std::setw(14) << stats.outputStallSeconds << std::setw(13)
+            << 100.0 * stats.getUtilization(wallSeconds) << "%\n";
+    std::cout << "Throughput is limited by the " << pipeline.getStats()[pipeline.getBottleneck()].name
+        << " stage" << std::endl;
+
+    return 0;
+}
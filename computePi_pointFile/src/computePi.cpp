@@ -0,0 +1,225 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostWorkers.hpp"
+#include "pointDecoding.hpp"
+#include "pointFile.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+// This example reads the points from a binary point file written by writePoints,
+// instead of generating them on the host.
+// The file is memory-mapped, and for CPU accelerators the kernel reads the mapped
+// columns directly, so the points are neither parsed nor copied.
+// For other accelerators the mapped columns are the source of the copy to the device.
+// Files with 16 bit encodings are decoded by the kernel while reading the points,
+// so only the encoded columns are read from memory and copied.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel, inputs are read-only encoded columns
+struct Points {
+    unsigned char const * x;
+    unsigned char const * y;
+    bool * inside;
+};
+
+// Kernel from the homework with striding and loop blocking,
+// which decodes the points with a decoder from pointDecoding.hpp
+struct PixelFinderKernelMultiplePointsPerThreadElements {
+    template<typename Acc, typename Decoder>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, Decoder decoder, float r, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float x = decoder(points.x, i);
+                float y = decoder(points.y, i);
+                float d = math::sqrt(acc, x * x + y * y);
+                points.inside[i] = (d <= r);
+            }
+        }
+    }
+};
+
+// Classify the points of the file and return the number of points inside.
+// For CPU accelerators the kernel works on the mapped file directly.
+template<typename Acc, typename Queue, typename WorkDiv, typename Decoder>
+uint32_t classify(Queue & queue, WorkDiv const & workDiv, PointFile const & file, Decoder decoder, float r,
+    std::true_type)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+    uint32_t n = static_cast<uint32_t>(file.getNumPoints());
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    auto insideBuffer = mem::buf::alloc<bool, Idx>(dev::getDev(queue), bufferExtent);
+    Points points;
+    points.x = file.getXData();
+    points.y = file.getYData();
+    points.inside = mem::view::getPtrNative(insideBuffer);
+
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv,
+        PixelFinderKernelMultiplePointsPerThreadElements{}, points, decoder, r, n);
+    queue::enqueue(queue, taskRunKernel);
+    alpaka::wait::wait(queue);
+
+    uint32_t P = 0;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (points.inside[i])
+            ++P;
+    }
+    return P;
+}
+
+// For other accelerators the mapped columns are copied to device buffers
+template<typename Acc, typename Queue, typename WorkDiv, typename Decoder>
+uint32_t classify(Queue & queue, WorkDiv const & workDiv, PointFile const & file, Decoder decoder, float r,
+    std::false_type)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+    uint32_t n = static_cast<uint32_t>(file.getNumPoints());
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    vec::Vec<Dim, Idx> columnExtent{n * getPointBytes(file.getEncoding())};
+    auto const devAcc = dev::getDev(queue);
+    auto const devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    // The views are only read from, as sources of copies
+    using HostView = mem::view::ViewPlainPtr<dev::DevCpu, unsigned char, Dim, Idx>;
+    HostView xView(const_cast<unsigned char *>(file.getXData()), devHost, columnExtent);
+    HostView yView(const_cast<unsigned char *>(file.getYData()), devHost, columnExtent);
+    auto insideBufferHost = mem::buf::alloc<bool, Idx>(devHost, bufferExtent);
+    auto xBufferAcc = mem::buf::alloc<unsigned char, Idx>(devAcc, columnExtent);
+    auto yBufferAcc = mem::buf::alloc<unsigned char, Idx>(devAcc, columnExtent);
+    auto insideBufferAcc = mem::buf::alloc<bool, Idx>(devAcc, bufferExtent);
+    Points pointsAcc;
+    pointsAcc.x = mem::view::getPtrNative(xBufferAcc);
+    pointsAcc.y = mem::view::getPtrNative(yBufferAcc);
+    pointsAcc.inside = mem::view::getPtrNative(insideBufferAcc);
+
+    mem::view::copy(queue, xBufferAcc, xView, columnExtent);
+    mem::view::copy(queue, yBufferAcc, yView, columnExtent);
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv,
+        PixelFinderKernelMultiplePointsPerThreadElements{}, pointsAcc, decoder, r, n);
+    queue::enqueue(queue, taskRunKernel);
+    mem::view::copy(queue, insideBufferHost, insideBufferAcc, bufferExtent);
+    alpaka::wait::wait(queue);
+
+    bool const * inside = mem::view::getPtrNative(insideBufferHost);
+    uint32_t P = 0;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        if (inside[i])
+            ++P;
+    }
+    return P;
+}
+
+// Usage: computePi_pointFile <file>
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+    using IsHostAcc = std::integral_constant<bool, std::is_same<dev::Dev<Acc>, dev::DevCpu>::value>;
+
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <file>, files are created with writePoints\n";
+        return 1;
+    }
+    auto start = std::chrono::steady_clock::now();
+    auto file = PointFile::open(argv[1]);
+    std::chrono::duration<double, std::milli> openDuration = std::chrono::steady_clock::now() - start;
+    if (!file)
+    {
+        std::cerr << file.getError() << "\n";
+        return 1;
+    }
+    // Column sizes in bytes have to be representable by the index type as well
+    if (file.getNumPoints() == 0
+        || file.getNumPoints() > std::numeric_limits<uint32_t>::max() / getPointBytes(file.getEncoding()))
+    {
+        std::cerr << "The number of points must be in [1, 2^30) for float32 and [1, 2^31) for 16 bit encodings\n";
+        return 1;
+    }
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Number of points and circle radius, the points are in [0, r] x [0, r]
+    uint32_t n = static_cast<uint32_t>(file.getNumPoints());
+    float r = file.getHeader().r;
+
+    // One block per host thread, each processing a contiguous range of points
+    uint32_t blocksPerGrid = getNumHostWorkers();
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = (n + blocksPerGrid - 1) / blocksPerGrid;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    // Classify with the decoder for the encoding of the file
+    auto runClassify = [&]() {
+        return dispatchPointDecoder(file.getHeader(), n, [&](auto decoder) {
+            return classify<Acc>(queue, workDiv, file, decoder, r, IsHostAcc{});
+        });
+    };
+
+    // The first run also reads the file into the page cache if needed and maps its pages
+    start = std::chrono::steady_clock::now();
+    uint32_t P = runClassify();
+    std::chrono::duration<double, std::milli> firstDuration = std::chrono::steady_clock::now() - start;
+    uint32_t numRepetitions = 5;
+    double bestDuration = 0.0;
+    for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+    {
+        start = std::chrono::steady_clock::now();
+        P = runClassify();
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        if (repetition == 0 || duration.count() < bestDuration)
+            bestDuration = duration.count();
+    }
+    float pi = 4.f * P / n;
+
+    // Output results
+    std::cout << "Computed pi is " << pi << " from " << n << " points encoded as "
+        << getPointEncodingName(file.getEncoding()) << ", "
+        << (IsHostAcc::value ? "read from the mapping" : "copied from the mapping") << "\n";
+    std::cout << "Open and map: " << openDuration.count() << " ms, first run: " << firstDuration.count()
+        << " ms, best run: " << bestDuration << " ms" << std::endl;
+
+    return 0;
+}
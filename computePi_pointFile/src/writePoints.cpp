@@ -0,0 +1,120 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "pointFile.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Writer of point files for computePi_pointFile, with points uniformly distributed
+// in [0, r] x [0, r] as generated in the other examples.
+// Points are generated and written in chunks, so the file may be larger than memory.
+// The coordinates are stored as floats, or quantized to 16 bit with the fixed16 encodings.
+// With sorted, points are spatially sorted: the square is divided into tiles, and consecutive
+// points lie in the same or neighboring tiles, so that chunks have small bounding boxes.
+
+// Tile coordinate from every second bit of a Z-order curve index
+uint32_t compactBits(uint32_t index)
+{
+    uint32_t coordinate = 0;
+    for (uint32_t bit = 0; bit < 16; bit++)
+        coordinate |= ((index >> (2 * bit)) & 1u) << bit;
+    return coordinate;
+}
+
+// Usage: writePoints <file> [n] [seed] [float32|fixed16|fixed16shuffled] [sorted]
+int main(int argc, char * argv[]) {
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <file> [n] [seed] [float32|fixed16|fixed16shuffled] [sorted]\n";
+        return 1;
+    }
+    // Number of points, circle radius and seed of the generator
+    uint64_t n = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 10000000;
+    float r = 10.0f;
+    uint32_t seed = (argc > 3) ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 2020;
+    PointEncoding encoding = PointEncoding::Float32;
+    if (argc > 4)
+    {
+        bool isKnown = false;
+        for (PointEncoding candidate : {PointEncoding::Float32, PointEncoding::Fixed16, PointEncoding::Fixed16Shuffled})
+            if (std::strcmp(argv[4], getPointEncodingName(candidate)) == 0)
+            {
+                encoding = candidate;
+                isKnown = true;
+            }
+        if (!isKnown)
+        {
+            std::cerr << "Unknown encoding " << argv[4] << ", use one of float32, fixed16, fixed16shuffled\n";
+            return 1;
+        }
+    }
+
+    bool isSorted = (argc > 5) && (std::strcmp(argv[5], "sorted") == 0);
+
+    PointFileWriter writer(argv[1], n, r, encoding);
+    if (!writer)
+    {
+        std::cerr << "Cannot create " << argv[1] << "\n";
+        return 1;
+    }
+    std::mt19937 generator{seed};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    // Tiles per dimension for sorted points, each tile gets the same number of points
+    uint32_t const tilesPerDim = 64;
+    uint64_t const numTiles = tilesPerDim * tilesPerDim;
+    float const tileSize = r / tilesPerDim;
+    // A multiple of the chunk size of shuffled files, as required by the writer
+    std::size_t const chunkSize = 1 << 20;
+    std::vector<float> x(chunkSize);
+    std::vector<float> y(chunkSize);
+    for (uint64_t first = 0; first < n; first += chunkSize)
+    {
+        std::size_t const count = static_cast<std::size_t>(std::min<uint64_t>(chunkSize, n - first));
+        for (std::size_t i = 0; i < count; i++)
+        {
+            x[i] = distribution(generator);
+            y[i] = distribution(generator);
+            if (isSorted)
+            {
+                // Scale the point into the tile, visiting tiles along a Z-order curve
+                uint32_t tile = static_cast<uint32_t>((first + i) * numTiles / n);
+                x[i] = std::min((compactBits(tile) + x[i] / r) * tileSize, r);
+                y[i] = std::min((compactBits(tile >> 1) + y[i] / r) * tileSize, r);
+            }
+        }
+        if (!writer.write(first, x.data(), y.data(), count))
+        {
+            std::cerr << "Writing " << argv[1] << " failed\n";
+            return 1;
+        }
+    }
+    if (!writer.close())
+    {
+        std::cerr << "Closing " << argv[1] << " failed\n";
+        return 1;
+    }
+    std::cout << "Wrote " << n << " points encoded as " << getPointEncodingName(encoding) << " to " << argv[1]
+        << std::endl;
+
+    return 0;
+}
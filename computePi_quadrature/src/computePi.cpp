@@ -0,0 +1,220 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// This example computes Pi as the integral of 4 / (1 + x^2) over [0, 1] with the midpoint rule.
+// Unlike the PixelFinder kernels it is compute-bound and sensitive to floating-point accuracy,
+// so all partial sums are compensated and combined in a fixed order.
+// The result is thus reproducible for a given work division on every back-end.
+
+// Maximum number of threads per block supported by the block reduction
+constexpr uint32_t maxBlockThreads = 256;
+
+// Floating-point operations per interval: 5 for the integrand, 4 for the compensated sum
+constexpr double flopPerInterval = 9.0;
+
+// Add value to the compensated sum (sum, compensation) with the Neumaier algorithm
+template<typename T>
+ALPAKA_FN_HOST_ACC void neumaierAdd(T & sum, T & compensation, T value)
+{
+    T t = sum + value;
+    T absSum = (sum >= T(0)) ? sum : -sum;
+    T absValue = (value >= T(0)) ? value : -value;
+    if (absSum >= absValue)
+        compensation += (sum - t) + value;
+    else
+        compensation += (value - t) + sum;
+    sum = t;
+}
+
+// Block shared memory for the reduction of per-thread compensated sums
+template<typename T>
+struct BlockReductionStorage {
+    T sums[maxBlockThreads];
+    T compensations[maxBlockThreads];
+};
+
+// Each thread sums the integrand over its intervals, using the same striding and
+// loop blocking as PixelFinderKernelMultiplePointsPerThreadElements.
+// Threads of a block then combine their sums with a tree reduction in shared memory,
+// and the first thread writes the block result; no atomics are used to stay deterministic.
+// The sums are not multiplied by the interval width, this is done once on host.
+template<typename T>
+struct QuadratureKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, T * blockSums, T * blockCompensations, uint32_t n) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+        uint32_t blockThreadIdx = idx::getIdx<Block, Threads>(acc)[0];
+        uint32_t blockThreadExtent = workdiv::getWorkDiv<Block, Threads>(acc)[0];
+        uint32_t gridBlockIdx = idx::getIdx<Grid, Blocks>(acc)[0];
+
+        T const h = T(1) / static_cast<T>(n);
+        T sum = T(0);
+        T compensation = T(0);
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                T x = (static_cast<T>(i) + T(0.5)) * h;
+                neumaierAdd(sum, compensation, T(4) / (T(1) + x * x));
+            }
+        }
+
+        auto & storage = block::shared::st::allocVar<BlockReductionStorage<T>, __COUNTER__>(acc);
+        storage.sums[blockThreadIdx] = sum;
+        storage.compensations[blockThreadIdx] = compensation;
+        block::sync::syncBlockThreads(acc);
+
+        // Tree reduction, also valid for a number of threads which is not a power of two
+        uint32_t stride = 1;
+        while (stride < blockThreadExtent)
+            stride *= 2;
+        for (stride /= 2; stride > 0; stride /= 2)
+        {
+            if (blockThreadIdx < stride && blockThreadIdx + stride < blockThreadExtent)
+            {
+                neumaierAdd(storage.sums[blockThreadIdx], storage.compensations[blockThreadIdx],
+                    storage.sums[blockThreadIdx + stride]);
+                storage.compensations[blockThreadIdx] += storage.compensations[blockThreadIdx + stride];
+            }
+            block::sync::syncBlockThreads(acc);
+        }
+
+        if (blockThreadIdx == 0)
+        {
+            blockSums[gridBlockIdx] = storage.sums[0];
+            blockCompensations[gridBlockIdx] = storage.compensations[0];
+        }
+    }
+};
+
+// Result of a single quadrature run
+struct QuadratureResult {
+    double pi;
+    double durationMs;
+};
+
+// Run the quadrature with the given type on the device and combine block results on host
+template<typename T, typename Acc, typename Queue>
+QuadratureResult computePi(Queue & queue, alpaka::dev::Dev<Acc> const & device, uint32_t n)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+
+    // Work division: the number of threads per block is limited by the accelerator
+    // and by the shared memory reserved for the reduction
+    auto const devProps = acc::getAccDevProps<Acc>(device);
+    uint32_t threadsPerBlock = std::min(maxBlockThreads,
+        static_cast<uint32_t>(std::min(devProps.m_blockThreadExtentMax[0], devProps.m_blockThreadCountMax)));
+    uint32_t elementsPerThread = 16;
+    uint32_t pointsPerBlock = threadsPerBlock * elementsPerThread;
+    uint32_t blocksPerGrid = std::min((n + pointsPerBlock - 1) / pointsPerBlock, 4096u);
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    vec::Vec<Dim, Idx> bufferExtent{blocksPerGrid};
+    auto sumsBufferHost = mem::buf::alloc<T, Idx>(devHost, bufferExtent);
+    auto compensationsBufferHost = mem::buf::alloc<T, Idx>(devHost, bufferExtent);
+    auto sumsBufferAcc = mem::buf::alloc<T, Idx>(device, bufferExtent);
+    auto compensationsBufferAcc = mem::buf::alloc<T, Idx>(device, bufferExtent);
+
+    auto start = std::chrono::steady_clock::now();
+
+    QuadratureKernel<T> quadratureKernel;
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, quadratureKernel,
+        mem::view::getPtrNative(sumsBufferAcc), mem::view::getPtrNative(compensationsBufferAcc), n);
+    queue::enqueue(queue, taskRunKernel);
+    mem::view::copy(queue, sumsBufferHost, sumsBufferAcc, bufferExtent);
+    mem::view::copy(queue, compensationsBufferHost, compensationsBufferAcc, bufferExtent);
+    alpaka::wait::wait(queue);
+
+    // Combine block results in a fixed order, in double precision
+    T const * sums = mem::view::getPtrNative(sumsBufferHost);
+    T const * compensations = mem::view::getPtrNative(compensationsBufferHost);
+    double sum = 0.0;
+    double compensation = 0.0;
+    for (uint32_t block = 0; block < blocksPerGrid; block++)
+    {
+        neumaierAdd(sum, compensation, static_cast<double>(sums[block]));
+        compensation += static_cast<double>(compensations[block]);
+    }
+    double pi = (sum + compensation) / n;
+
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> duration = end - start;
+    return {pi, duration.count()};
+}
+
+// Usage: computePi_quadrature [n]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    // Select the first device available on a system, for the chosen accelerator
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Number of intervals
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000000;
+    // Bounded, so that the strided loop of the kernel can not wrap around the 32 bit index
+    if (n == 0 || n > (1u << 31))
+    {
+        std::cerr << "Usage: " << argv[0] << " [n], with n in [1, 2^31]\n";
+        return 1;
+    }
+
+    auto const floatResult = computePi<float, Acc>(queue, device, n);
+    auto const doubleResult = computePi<double, Acc>(queue, device, n);
+
+    // Output results
+    double const referencePi = 3.14159265358979323846;
+    std::cout << std::setprecision(17);
+    for (auto const & result : {std::make_pair("float", floatResult), std::make_pair("double", doubleResult)})
+    {
+        std::cout << "Computed pi (" << result.first << ") is " << result.second.pi
+            << ", error " << std::abs(result.second.pi - referencePi) << "\n";
+        std::cout << "Execution time: " << result.second.durationMs << " ms, "
+            << flopPerInterval * n / result.second.durationMs * 1e-6 << " GFLOP/s\n";
+    }
+    std::cout << std::flush;
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostWorkers.hpp"
+
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// This example runs chains of dependent small kernels and copies, as jobs made of many small steps do.
+// Each step counts the points inside for one slice of the points and adds them to a counter on the device,
+// then copies the counter to the host, so every operation depends on the previous one.
+// The chains of 1 to maxChainLength steps are run on a blocking and on a non-blocking queue,
+// measuring for each
+// - the time the host spends enqueueing the chain,
+// - the latency from the first enqueue until the wait returns,
+// - the CPU time of the host thread, and of the whole process, during that latency.
+// With a blocking queue the host thread runs every step itself. With a non-blocking queue
+// the steps run in the thread of the queue, and the host thread is free for other work
+// unless it spins while waiting. The wait mode selects how the host waits for a non-blocking queue:
+// - wait: alpaka::wait::wait, which blocks on the queue,
+// - spin: polling queue::empty without pause,
+// - sleep: polling queue::empty with a sleep of sleepMicros in between.
+
+// Kernel from the homework with striding and loop blocking, which counts the points inside
+struct CountInsideKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, float const * x, float const * y, float r, uint32_t n,
+        uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float d = math::sqrt(acc, x[i] * x[i] + y[i] * y[i]);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// How the host waits for the queue
+enum class WaitMode {
+    Wait,
+    Spin,
+    Sleep
+};
+
+constexpr uint32_t sleepMicros = 20;
+
+// Wait until all operations in the queue are finished
+template<typename Queue>
+void waitForQueue(Queue & queue, WaitMode mode)
+{
+    using namespace alpaka;
+    if (mode == WaitMode::Spin)
+    {
+        while (!queue::empty(queue))
+        {
+        }
+    }
+    else if (mode == WaitMode::Sleep)
+    {
+        while (!queue::empty(queue))
+            std::this_thread::sleep_for(std::chrono::microseconds(sleepMicros));
+    }
+    // Returns at once after polling, and makes sure all operations are finished otherwise
+    alpaka::wait::wait(queue);
+}
+
+// CPU time in microseconds of the given clock, e.g. of the calling thread
+double getCpuMicros(clockid_t clock)
+{
+    timespec time;
+    clock_gettime(clock, &time);
+    return time.tv_sec * 1e6 + time.tv_nsec * 1e-3;
+}
+
+// Measurements of running one chain, in microseconds
+struct ChainResult {
+    double enqueue;
+    double latency;
+    double hostCpu;
+    double processCpu;
+    uint32_t count;
+};
+
+// Queue of the given kind with the buffers for running chains on the device
+template<typename Acc, typename QueueKind>
+class ChainRunner {
+public:
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using Queue = alpaka::queue::Queue<Acc, QueueKind>;
+
+    // Create the queue and copy numSlices slices of pointsPerStep points of the host arrays to the device
+    ChainRunner(alpaka::dev::Dev<Acc> const & device, float const * xHost, float const * yHost,
+        uint32_t pointsPerStep, uint32_t numSlices)
+        : m_queue(device), m_pointsPerStep(pointsPerStep), m_numSlices(numSlices),
+          m_xBuffer(alpaka::mem::buf::alloc<float, Idx>(device, alpaka::vec::Vec<Dim, Idx>{pointsPerStep * numSlices})),
+          m_yBuffer(alpaka::mem::buf::alloc<float, Idx>(device, alpaka::vec::Vec<Dim, Idx>{pointsPerStep * numSlices})),
+          m_countBuffer(alpaka::mem::buf::alloc<uint32_t, Idx>(device, alpaka::vec::Vec<Dim, Idx>{1u})),
+          m_countBufferHost(alpaka::mem::buf::alloc<uint32_t, Idx>(alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u),
+              alpaka::vec::Vec<Dim, Idx>{1u}))
+    {
+        using namespace alpaka;
+        auto const devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+        vec::Vec<Dim, Idx> extent{pointsPerStep * numSlices};
+        using HostView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>;
+        HostView xView(const_cast<float *>(xHost), devHost, extent);
+        HostView yView(const_cast<float *>(yHost), devHost, extent);
+        mem::view::copy(m_queue, m_xBuffer, xView, extent);
+        mem::view::copy(m_queue, m_yBuffer, yView, extent);
+        alpaka::wait::wait(m_queue);
+
+        // One block per host thread, each processing a contiguous range of the points of a step
+        m_blocksPerGrid = std::min(getNumHostWorkers(), pointsPerStep);
+    }
+
+    // Run a chain of the given number of steps, step i processes slice i modulo the number of slices
+    ChainResult run(uint32_t length, float r, WaitMode mode)
+    {
+        using namespace alpaka;
+        using Clock = std::chrono::steady_clock;
+        vec::Vec<Dim, Idx> countExtent{1u};
+        uint32_t elementsPerThread = (m_pointsPerStep + m_blocksPerGrid - 1) / m_blocksPerGrid;
+        auto workDiv = workdiv::WorkDivMembers<Dim, Idx>{m_blocksPerGrid, 1u, elementsPerThread};
+        float const * x = mem::view::getPtrNative(m_xBuffer);
+        float const * y = mem::view::getPtrNative(m_yBuffer);
+
+        ChainResult result;
+        double hostCpuStart = getCpuMicros(CLOCK_THREAD_CPUTIME_ID);
+        double processCpuStart = getCpuMicros(CLOCK_PROCESS_CPUTIME_ID);
+        auto start = Clock::now();
+        mem::view::set(m_queue, m_countBuffer, 0u, countExtent);
+        for (uint32_t step = 0; step < length; step++)
+        {
+            uint32_t first = (step % m_numSlices) * m_pointsPerStep;
+            auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, CountInsideKernel{}, x + first, y + first,
+                r, m_pointsPerStep, mem::view::getPtrNative(m_countBuffer));
+            queue::enqueue(m_queue, taskRunKernel);
+            mem::view::copy(m_queue, m_countBufferHost, m_countBuffer, countExtent);
+        }
+        auto enqueueEnd = Clock::now();
+        waitForQueue(m_queue, mode);
+        auto end = Clock::now();
+        result.hostCpu = getCpuMicros(CLOCK_THREAD_CPUTIME_ID) - hostCpuStart;
+        result.processCpu = getCpuMicros(CLOCK_PROCESS_CPUTIME_ID) - processCpuStart;
+        result.enqueue = std::chrono::duration<double, std::micro>(enqueueEnd - start).count();
+        result.latency = std::chrono::duration<double, std::micro>(end - start).count();
+        result.count = *mem::view::getPtrNative(m_countBufferHost);
+        return result;
+    }
+
+private:
+    using BufAccFloat = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, float, Dim, Idx>;
+    using BufAccCount = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, uint32_t, Dim, Idx>;
+    using BufHostCount = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, uint32_t, Dim, Idx>;
+
+    Queue m_queue;
+    uint32_t m_pointsPerStep;
+    uint32_t m_numSlices;
+    uint32_t m_blocksPerGrid;
+    BufAccFloat m_xBuffer;
+    BufAccFloat m_yBuffer;
+    BufAccCount m_countBuffer;
+    BufHostCount m_countBufferHost;
+};
+
+// Run chains of 1, 10, ... up to maxChainLength steps on a queue of the given kind and print the results.
+// Of numRepetitions runs the one with the lowest latency is reported.
+template<typename Acc, typename QueueKind>
+void benchmarkQueue(std::string const & queueName, std::vector<float> const & x, std::vector<float> const & y,
+    uint32_t pointsPerStep, uint32_t numSlices, float r, WaitMode mode, uint32_t maxChainLength,
+    std::vector<uint32_t> & counts)
+{
+    using namespace alpaka;
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    ChainRunner<Acc, QueueKind> runner(device, x.data(), y.data(), pointsPerStep, numSlices);
+
+    // Untimed run, e.g. for starting up the runtime of the back-end
+    runner.run(1, r, mode);
+
+    uint32_t numRepetitions = 5;
+    uint32_t lengthIdx = 0;
+    for (uint64_t length = 1; length <= maxChainLength; length *= 10, lengthIdx++)
+    {
+        ChainResult best{};
+        for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+        {
+            ChainResult result = runner.run(static_cast<uint32_t>(length), r, mode);
+            if (repetition == 0 || result.latency < best.latency)
+                best = result;
+        }
+        std::cout << "    " << std::setw(11) << std::left << queueName << std::right << std::setw(8) << length
+            << std::setw(13) << best.enqueue << std::setw(13) << best.latency << std::setw(13)
+            << best.latency / length << std::setw(13) << best.hostCpu << std::setw(16) << best.processCpu
+            << std::setw(13) << 4.f * best.count / (length * pointsPerStep) << "\n";
+
+        // The counts must not depend on the kind of queue
+        if (lengthIdx < counts.size() && counts[lengthIdx] != best.count)
+            std::cout << "    Warning: " << best.count << " points inside, other queue had " << counts[lengthIdx]
+                << "\n";
+        if (lengthIdx >= counts.size())
+            counts.push_back(best.count);
+    }
+}
+
+// Compare both kinds of queues for the given accelerator
+template<typename Acc>
+void benchmarkBackEnd(std::vector<float> const & x, std::vector<float> const & y, uint32_t pointsPerStep,
+    uint32_t numSlices, float r, WaitMode mode, uint32_t maxChainLength)
+{
+    using namespace alpaka;
+    std::cout << acc::getAccName<Acc>() << "\n";
+    std::cout << "    " << std::setw(11) << std::left << "queue" << std::right << std::setw(8) << "length"
+        << std::setw(13) << "enqueue us" << std::setw(13) << "latency us" << std::setw(13) << "per step us"
+        << std::setw(13) << "host CPU us" << std::setw(16) << "process CPU us" << std::setw(13) << "pi" << "\n";
+    std::vector<uint32_t> counts;
+    benchmarkQueue<Acc, queue::Blocking>("Blocking", x, y, pointsPerStep, numSlices, r, mode, maxChainLength, counts);
+    benchmarkQueue<Acc, queue::NonBlocking>("NonBlocking", x, y, pointsPerStep, numSlices, r, mode, maxChainLength,
+        counts);
+}
+
+// Usage: computePi_queueChains [pointsPerStep] [wait|spin|sleep] [maxChainLength]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Points per step, small as the kernels of such chains are
+    uint32_t pointsPerStep = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 4096;
+    WaitMode mode = WaitMode::Wait;
+    if (argc > 2 && std::strcmp(argv[2], "spin") == 0)
+        mode = WaitMode::Spin;
+    else if (argc > 2 && std::strcmp(argv[2], "sleep") == 0)
+        mode = WaitMode::Sleep;
+    else if (argc > 2 && std::strcmp(argv[2], "wait") != 0)
+        pointsPerStep = 0;
+    uint32_t maxChainLength = (argc > 3) ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 10000;
+    // The steps cycle through the slices, so that the points are not all the same
+    uint32_t numSlices = 64;
+    // The counter on the device has 32 bits, it must hold all points of the longest chain
+    if (pointsPerStep == 0 || pointsPerStep > (1u << 20) || maxChainLength == 0
+        || static_cast<uint64_t>(pointsPerStep) * maxChainLength >= (1ull << 32))
+    {
+        std::cerr << "Usage: " << argv[0] << " [pointsPerStep] [wait|spin|sleep] [maxChainLength], "
+            << "with pointsPerStep in [1, 2^20], maxChainLength > 0 and pointsPerStep * maxChainLength < 2^32\n";
+        return 1;
+    }
+
+    // Circle radius
+    float r = 10.0f;
+
+    // Generate input x, y randomly in [0, r]
+    uint32_t n = pointsPerStep * numSlices;
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    std::random_device rd;
+    std::mt19937 generator{rd()};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        x[idx] = distribution(generator);
+        y[idx] = distribution(generator);
+    }
+
+    char const * modeNames[] = {"wait", "spin", "sleep"};
+    std::cout << pointsPerStep << " points per step, waiting with " << modeNames[static_cast<int>(mode)] << "\n";
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    benchmarkBackEnd<acc::AccCpuSerial<Dim, Idx>>(x, y, pointsPerStep, numSlices, r, mode, maxChainLength);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    benchmarkBackEnd<acc::AccCpuOmp2Blocks<Dim, Idx>>(x, y, pointsPerStep, numSlices, r, mode, maxChainLength);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+    benchmarkBackEnd<acc::AccCpuOmp2Threads<Dim, Idx>>(x, y, pointsPerStep, numSlices, r, mode, maxChainLength);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    benchmarkBackEnd<acc::AccCpuThreads<Dim, Idx>>(x, y, pointsPerStep, numSlices, r, mode, maxChainLength);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    benchmarkBackEnd<acc::AccCpuTbbBlocks<Dim, Idx>>(x, y, pointsPerStep, numSlices, r, mode, maxChainLength);
+#endif
+
+    return 0;
+}
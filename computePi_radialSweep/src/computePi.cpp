@@ -0,0 +1,222 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// This example evaluates the same set of points against many radii in a single pass.
+// Instead of the inside flag for one radius, each point is assigned to the first radius bin
+// containing it, and the cumulative sum of the bin counts gives the number of points
+// inside every radius (the radial cumulative distribution function).
+
+// Structure with memory buffers for inputs (x, y) of the kernel
+struct Points {
+    float * x;
+    float * y;
+};
+
+// Maximum number of radii supported by the block-private histogram
+constexpr uint32_t maxRadii = 256;
+
+// Block shared memory for the block-private histogram
+struct BlockHistogram {
+    uint32_t counts[maxRadii];
+};
+
+// Index of the first of the sorted radii which is not less than d,
+// numRadii if d is larger than all radii
+ALPAKA_FN_HOST_ACC uint32_t findRadiusBin(float const * radii, uint32_t numRadii, float d)
+{
+    uint32_t first = 0;
+    uint32_t last = numRadii;
+    while (first < last)
+    {
+        uint32_t middle = first + (last - first) / 2;
+        if (radii[middle] < d)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    return first;
+}
+
+// Points are distributed between threads with striding and loop blocking
+// as in PixelFinderKernelMultiplePointsPerThreadElements.
+// Each block accumulates a private histogram in shared memory,
+// which is merged into the global one with atomics once the block is done.
+struct PixelFinderKernelRadialSweep {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Points points, float const * radii, uint32_t numRadii,
+        uint32_t n, uint32_t * binCounts) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+        uint32_t blockThreadIdx = idx::getIdx<Block, Threads>(acc)[0];
+        uint32_t blockThreadExtent = workdiv::getWorkDiv<Block, Threads>(acc)[0];
+
+        auto & blockHistogram = block::shared::st::allocVar<BlockHistogram, __COUNTER__>(acc);
+        for (uint32_t bin = blockThreadIdx; bin < numRadii; bin += blockThreadExtent)
+            blockHistogram.counts[bin] = 0;
+        block::sync::syncBlockThreads(acc);
+
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float x = points.x[i];
+                float y = points.y[i];
+                float d = math::sqrt(acc, x * x + y * y);
+                uint32_t bin = findRadiusBin(radii, numRadii, d);
+                // Points outside of all radii are not counted
+                if (bin < numRadii)
+                    atomic::atomicOp<atomic::op::Add>(acc, &blockHistogram.counts[bin], 1u, hierarchy::Threads{});
+            }
+        }
+        block::sync::syncBlockThreads(acc);
+
+        for (uint32_t bin = blockThreadIdx; bin < numRadii; bin += blockThreadExtent)
+            if (blockHistogram.counts[bin])
+                atomic::atomicOp<atomic::op::Add>(acc, &binCounts[bin], blockHistogram.counts[bin]);
+    }
+};
+
+int main() {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    // Select the first device available on a system, for the chosen accelerator
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Number of points
+    uint32_t n = 1000000;
+
+    // Sorted radii, the largest one defines the square [0, r] x [0, r] of the points
+    uint32_t numRadii = 64;
+    float r = 10.0f;
+    if (numRadii > maxRadii)
+    {
+        std::cerr << "At most " << maxRadii << " radii are supported\n";
+        return 1;
+    }
+
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    vec::Vec<Dim, Idx> radiiExtent{numRadii};
+    auto xBufferHost = mem::buf::alloc<float, Idx>(devHost, bufferExtent);
+    auto yBufferHost = mem::buf::alloc<float, Idx>(devHost, bufferExtent);
+    auto radiiBufferHost = mem::buf::alloc<float, Idx>(devHost, radiiExtent);
+    auto binCountsBufferHost = mem::buf::alloc<uint32_t, Idx>(devHost, radiiExtent);
+
+    Points pointsHost;
+    pointsHost.x = mem::view::getPtrNative(xBufferHost);
+    pointsHost.y = mem::view::getPtrNative(yBufferHost);
+    float * radii = mem::view::getPtrNative(radiiBufferHost);
+    for (uint32_t k = 0; k < numRadii; k++)
+        radii[k] = r * (k + 1) / numRadii;
+
+    // Generate input x, y randomly in [0, r]
+    std::random_device rd;
+    std::mt19937 generator{rd()};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        pointsHost.x[idx] = distribution(generator);
+        pointsHost.y[idx] = distribution(generator);
+    }
+
+    auto xBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto yBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto radiiBufferAcc = mem::buf::alloc<float, Idx>(device, radiiExtent);
+    auto binCountsBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, radiiExtent);
+    Points pointsAcc;
+    pointsAcc.x = mem::view::getPtrNative(xBufferAcc);
+    pointsAcc.y = mem::view::getPtrNative(yBufferAcc);
+
+    auto start = std::chrono::steady_clock::now();
+
+    mem::view::copy(queue, xBufferAcc, xBufferHost, bufferExtent);
+    mem::view::copy(queue, yBufferAcc, yBufferHost, bufferExtent);
+    mem::view::copy(queue, radiiBufferAcc, radiiBufferHost, radiiExtent);
+    mem::view::set(queue, binCountsBufferAcc, 0u, radiiExtent);
+
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = 256;
+    uint32_t blocksPerGrid = (n + elementsPerThread - 1) / elementsPerThread;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    PixelFinderKernelRadialSweep pixelFinderKernel;
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, pixelFinderKernel, pointsAcc,
+        mem::view::getPtrNative(radiiBufferAcc), numRadii, n, mem::view::getPtrNative(binCountsBufferAcc));
+    queue::enqueue(queue, taskRunKernel);
+    mem::view::copy(queue, binCountsBufferHost, binCountsBufferAcc, radiiExtent);
+    alpaka::wait::wait(queue);
+
+    // Cumulative counts give the number of points inside each radius
+    uint32_t const * binCounts = mem::view::getPtrNative(binCountsBufferHost);
+    std::vector<uint32_t> insideCounts(numRadii);
+    uint32_t cumulativeCount = 0;
+    for (uint32_t k = 0; k < numRadii; k++)
+    {
+        cumulativeCount += binCounts[k];
+        insideCounts[k] = cumulativeCount;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> duration = end - start;
+
+    // Verify against a direct count on host for every radius
+    uint32_t numMismatches = 0;
+    for (uint32_t k = 0; k < numRadii; k++)
+    {
+        uint32_t P = 0;
+        for (uint32_t i = 0; i < n; ++i)
+            if (std::sqrt(pointsHost.x[i] * pointsHost.x[i] + pointsHost.y[i] * pointsHost.y[i]) <= radii[k])
+                ++P;
+        if (P != insideCounts[k])
+            ++numMismatches;
+    }
+
+    // Output results: for radius rk <= r, the fraction of points inside is pi * rk^2 / (4 * r^2)
+    for (uint32_t k = numRadii / 8 - 1; k < numRadii; k += numRadii / 8)
+    {
+        float pi = 4.f * insideCounts[k] / n * (r / radii[k]) * (r / radii[k]);
+        std::cout << "Radius " << radii[k] << ": " << insideCounts[k] << " points inside, computed pi is "
+            << pi << "\n";
+    }
+    std::cout << "Mismatches against the direct count: " << numMismatches << "\n";
+    std::cout << "Execution time for " << numRadii << " radii: " << duration.count() << " ms" << std::endl;
+
+    return numMismatches == 0 ? 0 : 1;
+}
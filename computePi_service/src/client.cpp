@@ -0,0 +1,173 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "protocol.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Client of computePi_service, which measures the latency of estimation requests
+// as seen by the client, from sending a request to receiving its response.
+// Several connections send their requests concurrently, one request at a time each,
+// so the service can batch requests of different connections.
+
+// Connect to the service, return -1 on failure
+int connectToService(std::string const & socketPath)
+{
+    sockaddr_un address;
+    if (!makeSocketAddress(socketPath, address))
+        return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Send a request and wait for its response, return false if the connection failed
+bool call(int fd, Request const & request, Response & response)
+{
+    return sendAll(fd, &request, sizeof(request)) && receiveAll(fd, &response, sizeof(response))
+        && response.magic == responseMagic && response.id == request.id;
+}
+
+double getPercentile(std::vector<double> latencies, double fraction)
+{
+    if (latencies.empty())
+        return 0.0;
+    auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(fraction * (latencies.size() - 1));
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return *nth;
+}
+
+// Usage: computePi_serviceClient <socketPath> [numConnections] [requestsPerConnection] [n] [random|grid] [shutdown]
+int main(int argc, char * argv[]) {
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0]
+            << " <socketPath> [numConnections] [requestsPerConnection] [n] [random|grid] [shutdown]\n";
+        return 1;
+    }
+    std::string socketPath = argv[1];
+    uint32_t numConnections = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 8;
+    uint32_t requestsPerConnection = (argc > 3) ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 1000;
+    uint32_t n = (argc > 4) ? static_cast<uint32_t>(std::strtoul(argv[4], nullptr, 10)) : 100000;
+    KernelKind kernel = (argc > 5 && std::strcmp(argv[5], "grid") == 0) ? KernelKind::Grid : KernelKind::Random;
+    bool isShutdown = argc > 6 && std::strcmp(argv[6], "shutdown") == 0;
+    float r = 10.0f;
+
+    // Each connection records its own latencies and results
+    std::vector<std::vector<double>> latencies(numConnections);
+    std::vector<double> piSums(numConnections, 0.0);
+    std::vector<uint64_t> batchSizeSums(numConnections, 0);
+    std::vector<uint32_t> numPoints(numConnections, n);
+    std::vector<bool> isOk(numConnections, false);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t connection = 0; connection < numConnections; connection++)
+        threads.emplace_back([&, connection]() {
+            int fd = connectToService(socketPath);
+            if (fd < 0)
+                return;
+            bool ok = true;
+            for (uint32_t i = 0; i < requestsPerConnection && ok; i++)
+            {
+                uint64_t id = static_cast<uint64_t>(connection) * requestsPerConnection + i;
+                Request request{requestMagic, RequestType::Estimate, kernel, n, r, static_cast<uint32_t>(id), id};
+                Response response{};
+                auto requestStart = std::chrono::steady_clock::now();
+                ok = call(fd, request, response) && response.status == 0;
+                std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - requestStart;
+                // Failed requests end the connection and are not accounted
+                if (!ok)
+                    break;
+                latencies[connection].push_back(latency.count());
+                piSums[connection] += response.pi;
+                batchSizeSums[connection] += response.batchSize;
+                numPoints[connection] = response.numPoints;
+            }
+            isOk[connection] = ok;
+            close(fd);
+        });
+    for (auto & thread : threads)
+        thread.join();
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    std::vector<double> allLatencies;
+    double piSum = 0.0;
+    uint64_t batchSizeSum = 0;
+    for (uint32_t connection = 0; connection < numConnections; connection++)
+    {
+        if (!isOk[connection])
+        {
+            std::cerr << "Connection " << connection << " to " << socketPath << " failed\n";
+            return 1;
+        }
+        allLatencies.insert(allLatencies.end(), latencies[connection].begin(), latencies[connection].end());
+        piSum += piSums[connection];
+        batchSizeSum += batchSizeSums[connection];
+    }
+    std::size_t numRequests = allLatencies.size();
+    if (numRequests == 0)
+    {
+        std::cout << "No requests sent" << std::endl;
+        return 0;
+    }
+
+    // Output results
+    std::cout << "Mean computed pi is " << piSum / numRequests << " from " << numRequests << " requests of " << n
+        << " points";
+    // The grid kernel uses a full square grid of at most n points
+    if (numPoints[0] != n)
+        std::cout << " (" << numPoints[0] << " used)";
+    std::cout << ", " << numRequests / duration.count() << " requests/s, mean batch size "
+        << static_cast<double>(batchSizeSum) / numRequests << "\n";
+    std::cout << "Client latency p50 " << getPercentile(allLatencies, 0.5) << " us, p99 "
+        << getPercentile(allLatencies, 0.99) << " us\n";
+
+    // Query the latencies measured by the service, and stop it if asked to
+    int fd = connectToService(socketPath);
+    Request statsRequest{requestMagic, RequestType::Stats, KernelKind::Random, 0, 0.0f, 0, 0};
+    Response stats{};
+    if (fd >= 0 && call(fd, statsRequest, stats))
+        std::cout << "Service latency p50 " << stats.p50Micros << " us, p99 " << stats.p99Micros << " us over "
+            << stats.numRequests << " requests in " << stats.numBatches << " launches\n";
+    if (fd >= 0 && isShutdown)
+    {
+        Request shutdownRequest{requestMagic, RequestType::Shutdown, KernelKind::Random, 0, 0.0f, 0, 1};
+        Response response{};
+        call(fd, shutdownRequest, response);
+    }
+    if (fd >= 0)
+        close(fd);
+    std::cout << std::flush;
+
+    return 0;
+}
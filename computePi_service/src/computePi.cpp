@@ -0,0 +1,549 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "bufferPool.hpp"
+#include "protocol.hpp"
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// This example keeps the accelerator warm in a long-running service, so that requests
+// do not pay for device discovery, queue creation, buffer allocation and the start of
+// the thread pool of the back-end, which dominate the latency of small estimations.
+// Requests arrive over a Unix domain socket with the binary protocol of protocol.hpp,
+// computePi_serviceClient sends them.
+// Requests arriving close together, also from different connections, are batched
+// into a single kernel launch, and all buffers are taken from caching pools.
+// The service measures the latency of every request, from its arrival to its response,
+// and reports the 50th and 99th percentiles on request and at shutdown.
+
+// Parameters of an estimation in a batch
+struct Job {
+    uint32_t seed;
+    float r;
+    uint32_t n;
+    KernelKind kernel;
+    // Number of grid cells per dimension, for the grid kernel
+    uint32_t gridSide;
+};
+
+// Contiguous range of the points of a job, processed by one block
+struct Task {
+    uint32_t job;
+    uint32_t first;
+    uint32_t count;
+    // Index of the task among the tasks of its job
+    uint32_t taskInJob;
+};
+
+// Points per task, so that large jobs are spread over several blocks
+constexpr uint32_t taskPoints = 1u << 16;
+
+// Each block processes one task at a time, threads of the block stride over its points.
+// The counts of all tasks of a job are added up with atomics in global memory.
+struct BatchedEstimateKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Job const * jobs, Task const * tasks, uint32_t numTasks,
+        uint32_t * counts) const
+    {
+        using namespace alpaka;
+        uint32_t gridBlockIdx = idx::getIdx<Grid, Blocks>(acc)[0];
+        uint32_t gridBlockExtent = workdiv::getWorkDiv<Grid, Blocks>(acc)[0];
+        uint32_t blockThreadIdx = idx::getIdx<Block, Threads>(acc)[0];
+        uint32_t blockThreadExtent = workdiv::getWorkDiv<Block, Threads>(acc)[0];
+
+        for (uint32_t taskIdx = gridBlockIdx; taskIdx < numTasks; taskIdx += gridBlockExtent)
+        {
+            Task const task = tasks[taskIdx];
+            Job const job = jobs[task.job];
+            uint32_t localCount = 0;
+            if (job.kernel == KernelKind::Random)
+            {
+                // Each thread of each task uses its own subsequence of the job's random stream
+                auto generator = rand::generator::createDefault(acc, job.seed,
+                    task.taskInJob * blockThreadExtent + blockThreadIdx);
+                auto distribution = rand::distribution::createUniformReal<float>(acc);
+                for (uint32_t i = blockThreadIdx; i < task.count; i += blockThreadExtent)
+                {
+                    float x = job.r * distribution(generator);
+                    float y = job.r * distribution(generator);
+                    float d = math::sqrt(acc, x * x + y * y);
+                    localCount += (d <= job.r);
+                }
+            }
+            else
+            {
+                float cellWidth = job.r / job.gridSide;
+                for (uint32_t i = task.first + blockThreadIdx; i < task.first + task.count; i += blockThreadExtent)
+                {
+                    float x = (i % job.gridSide + 0.5f) * cellWidth;
+                    float y = (i / job.gridSide + 0.5f) * cellWidth;
+                    float d = math::sqrt(acc, x * x + y * y);
+                    localCount += (d <= job.r);
+                }
+            }
+            atomic::atomicOp<atomic::op::Add>(acc, &counts[task.job], localCount);
+        }
+    }
+};
+
+// Client connection, responses may be sent from any thread
+class Connection {
+public:
+    explicit Connection(int fd) : m_fd(fd)
+    {
+    }
+
+    Connection(Connection const &) = delete;
+    Connection & operator=(Connection const &) = delete;
+
+    ~Connection()
+    {
+        close(m_fd);
+    }
+
+    int getFd() const
+    {
+        return m_fd;
+    }
+
+    bool send(Response const & response)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return sendAll(m_fd, &response, sizeof(response));
+    }
+
+private:
+    int m_fd;
+    std::mutex m_mutex;
+};
+
+struct PendingRequest {
+    Request request;
+    std::shared_ptr<Connection> connection;
+    std::chrono::steady_clock::time_point arrival;
+};
+
+// Requests waiting to be processed, filled by the connection threads
+class RequestQueue {
+public:
+    void push(PendingRequest pending)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.push_back(std::move(pending));
+        }
+        m_condition.notify_one();
+    }
+
+    // Wake up the waiting popBatch, also when there are no requests
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_isStopped = true;
+        }
+        m_condition.notify_one();
+    }
+
+    // Wait for the next batch of up to maxBatch requests. After the first request has arrived,
+    // wait up to window for more, so that requests arriving close together share a launch.
+    // Returns false when stopped and no requests are left.
+    bool popBatch(std::size_t maxBatch, std::chrono::microseconds window, std::vector<PendingRequest> & batch)
+    {
+        batch.clear();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [&]() { return !m_requests.empty() || m_isStopped; });
+        if (m_requests.empty())
+            return false;
+        auto deadline = m_requests.front().arrival + window;
+        m_condition.wait_until(lock, deadline, [&]() { return m_requests.size() >= maxBatch || m_isStopped; });
+        while (!m_requests.empty() && batch.size() < maxBatch)
+        {
+            batch.push_back(std::move(m_requests.front()));
+            m_requests.pop_front();
+        }
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<PendingRequest> m_requests;
+    bool m_isStopped = false;
+};
+
+// Latencies of the most recent requests
+class LatencyStats {
+public:
+    void add(double micros)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_latencies.size() < maxSamples)
+            m_latencies.push_back(micros);
+        else
+            m_latencies[m_numRequests % maxSamples] = micros;
+        m_numRequests++;
+    }
+
+    void addBatch()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_numBatches++;
+    }
+
+    // Fill the statistics fields of the response
+    void fill(Response & response) const
+    {
+        std::vector<double> latencies;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            latencies = m_latencies;
+            response.numRequests = m_numRequests;
+            response.numBatches = static_cast<uint32_t>(m_numBatches);
+        }
+        response.p50Micros = getPercentile(latencies, 0.5);
+        response.p99Micros = getPercentile(latencies, 0.99);
+    }
+
+private:
+    static constexpr std::size_t maxSamples = 1 << 16;
+
+    static double getPercentile(std::vector<double> & latencies, double fraction)
+    {
+        if (latencies.empty())
+            return 0.0;
+        auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(fraction * (latencies.size() - 1));
+        std::nth_element(latencies.begin(), nth, latencies.end());
+        return *nth;
+    }
+
+    mutable std::mutex m_mutex;
+    std::vector<double> m_latencies;
+    uint64_t m_numRequests = 0;
+    uint64_t m_numBatches = 0;
+};
+
+// Warm state of the accelerator, processing batches of estimations in single launches
+template<typename Acc>
+class Estimator {
+public:
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using DevAcc = alpaka::dev::Dev<Acc>;
+    using Queue = alpaka::queue::Queue<Acc, alpaka::queue::Blocking>;
+
+    Estimator()
+        : m_device(alpaka::pltf::getDevByIdx<Acc>(0u)), m_devHost(alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u)),
+          m_queue(m_device), m_jobPoolHost(m_devHost, 64), m_taskPoolHost(m_devHost, 64),
+          m_countPoolHost(m_devHost, 64), m_jobPoolAcc(m_device, 64), m_taskPoolAcc(m_device, 64),
+          m_countPoolAcc(m_device, 64)
+    {
+        // Use several threads per block where the back-end allows it
+        auto const devProps = alpaka::acc::getAccDevProps<Acc>(m_device);
+        m_threadsPerBlock = std::min(static_cast<uint32_t>(devProps.m_blockThreadExtentMax[0]), 16u);
+    }
+
+    // Estimate all jobs in one launch and return the number of points inside of each
+    std::vector<uint32_t> estimate(std::vector<Job> const & jobs)
+    {
+        using namespace alpaka;
+        uint32_t const numJobs = static_cast<uint32_t>(jobs.size());
+        std::vector<Task> tasks;
+        for (uint32_t job = 0; job < numJobs; job++)
+            for (uint32_t first = 0, taskInJob = 0; first < jobs[job].n; first += taskPoints, taskInJob++)
+                tasks.push_back(Task{job, first, std::min(taskPoints, jobs[job].n - first), taskInJob});
+        uint32_t const numTasks = static_cast<uint32_t>(tasks.size());
+
+        auto jobsHost = m_jobPoolHost.acquire(numJobs);
+        auto tasksHost = m_taskPoolHost.acquire(numTasks);
+        auto countsHost = m_countPoolHost.acquire(numJobs);
+        auto jobsAcc = m_jobPoolAcc.acquire(numJobs);
+        auto tasksAcc = m_taskPoolAcc.acquire(numTasks);
+        auto countsAcc = m_countPoolAcc.acquire(numJobs);
+        std::copy(jobs.begin(), jobs.end(), jobsHost.getPtr());
+        std::copy(tasks.begin(), tasks.end(), tasksHost.getPtr());
+
+        // Pooled buffers may be larger, so all copies use explicit extents
+        vec::Vec<Dim, Idx> jobExtent{numJobs};
+        vec::Vec<Dim, Idx> taskExtent{numTasks};
+        mem::view::copy(m_queue, jobsAcc.getBuf(), jobsHost.getBuf(), jobExtent);
+        mem::view::copy(m_queue, tasksAcc.getBuf(), tasksHost.getBuf(), taskExtent);
+        mem::view::set(m_queue, countsAcc.getBuf(), 0u, jobExtent);
+        using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+        auto workDiv = WorkDiv{numTasks, m_threadsPerBlock, 1u};
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, BatchedEstimateKernel{}, jobsAcc.getPtr(),
+            tasksAcc.getPtr(), numTasks, countsAcc.getPtr());
+        queue::enqueue(m_queue, taskRunKernel);
+        mem::view::copy(m_queue, countsHost.getBuf(), countsAcc.getBuf(), jobExtent);
+        alpaka::wait::wait(m_queue);
+        return std::vector<uint32_t>(countsHost.getPtr(), countsHost.getPtr() + numJobs);
+    }
+
+private:
+    DevAcc m_device;
+    alpaka::dev::DevCpu m_devHost;
+    Queue m_queue;
+    uint32_t m_threadsPerBlock;
+    BufferPool<Job, Idx, alpaka::dev::DevCpu> m_jobPoolHost;
+    BufferPool<Task, Idx, alpaka::dev::DevCpu> m_taskPoolHost;
+    BufferPool<uint32_t, Idx, alpaka::dev::DevCpu> m_countPoolHost;
+    BufferPool<Job, Idx, DevAcc> m_jobPoolAcc;
+    BufferPool<Task, Idx, DevAcc> m_taskPoolAcc;
+    BufferPool<uint32_t, Idx, DevAcc> m_countPoolAcc;
+};
+
+// Largest integer whose square is not above n
+uint32_t getSquareRootFloor(uint32_t n)
+{
+    uint64_t side = static_cast<uint64_t>(std::sqrt(static_cast<double>(n)));
+    // Correct the rounding of the floating point square root
+    while (side * side > n)
+        side--;
+    while ((side + 1) * (side + 1) <= n)
+        side++;
+    return static_cast<uint32_t>(side);
+}
+
+// Set by SIGINT and SIGTERM
+std::atomic<bool> isStopRequested{false};
+
+void handleStopSignal(int)
+{
+    isStopRequested = true;
+}
+
+// Read the requests of a connection until it is closed. Estimations are queued,
+// other requests are answered right away.
+void serveConnection(std::shared_ptr<Connection> connection, RequestQueue & requests, LatencyStats & stats)
+{
+    Request request;
+    while (receiveAll(connection->getFd(), &request, sizeof(request)))
+    {
+        auto arrival = std::chrono::steady_clock::now();
+        if (request.magic != requestMagic)
+            break;
+        Response response{};
+        response.magic = responseMagic;
+        response.id = request.id;
+        if (request.type == RequestType::Estimate)
+        {
+            bool isValid = request.n > 0 && request.r > 0.0f
+                && (request.kernel == KernelKind::Random || request.kernel == KernelKind::Grid);
+            if (isValid)
+            {
+                requests.push(PendingRequest{request, connection, arrival});
+                continue;
+            }
+            response.status = EINVAL;
+        }
+        else if (request.type == RequestType::Stats)
+            stats.fill(response);
+        else if (request.type == RequestType::Shutdown)
+            isStopRequested = true;
+        else
+            response.status = EINVAL;
+        connection->send(response);
+    }
+    // Stop receiving, responses of queued requests can still be sent
+    shutdown(connection->getFd(), SHUT_RD);
+}
+
+// Usage: computePi_service <socketPath> [maxBatch] [batchWindowMicros]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <socketPath> [maxBatch] [batchWindowMicros]\n";
+        return 1;
+    }
+    std::string socketPath = argv[1];
+    std::size_t maxBatch = (argc > 2) ? std::max(std::strtoul(argv[2], nullptr, 10), 1ul) : 64;
+    std::chrono::microseconds batchWindow{(argc > 3) ? std::strtol(argv[3], nullptr, 10) : 200};
+
+    // All cold-start costs are paid once here: device discovery, queue creation and,
+    // with a warm-up launch, the thread pool of the back-end and the first buffers of the pools
+    auto start = std::chrono::steady_clock::now();
+    Estimator<Acc> estimator;
+    estimator.estimate(std::vector<Job>{Job{0, 1.0f, taskPoints, KernelKind::Random, 1}});
+    std::chrono::duration<double, std::milli> warmUpDuration = std::chrono::steady_clock::now() - start;
+
+    sockaddr_un address;
+    if (!makeSocketAddress(socketPath, address))
+    {
+        std::cerr << "Socket path " << socketPath << " is too long\n";
+        return 1;
+    }
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    // A socket file left behind by a killed service would make bind fail
+    unlink(socketPath.c_str());
+    if (listenFd < 0 || bind(listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0
+        || listen(listenFd, 64) != 0)
+    {
+        std::cerr << "Cannot listen on " << socketPath << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    struct sigaction action{};
+    action.sa_handler = handleStopSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    std::cout << "Listening on " << socketPath << ", warm-up took " << warmUpDuration.count() << " ms, batches of up to "
+        << maxBatch << " requests within " << batchWindow.count() << " us" << std::endl;
+
+    RequestQueue requests;
+    LatencyStats stats;
+    // Open connections and their threads by id. A connection is removed when its thread
+    // stops reading, its socket is closed when the last of its queued requests is answered.
+    // Finished threads are joined by the accept thread.
+    std::mutex connectionsMutex;
+    std::map<uint64_t, std::shared_ptr<Connection>> connections;
+    std::map<uint64_t, std::thread> connectionThreads;
+    std::vector<uint64_t> finishedConnections;
+    auto joinFinishedConnections = [&]() {
+        std::vector<std::thread> finishedThreads;
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            for (uint64_t id : finishedConnections)
+            {
+                finishedThreads.push_back(std::move(connectionThreads[id]));
+                connectionThreads.erase(id);
+            }
+            finishedConnections.clear();
+        }
+        for (auto & thread : finishedThreads)
+            thread.join();
+    };
+    // Accept connections until a stop is requested, polling so that the flag is noticed
+    std::thread acceptThread([&]() {
+        uint64_t nextId = 0;
+        while (!isStopRequested)
+        {
+            joinFinishedConnections();
+            pollfd pollFd{listenFd, POLLIN, 0};
+            if (poll(&pollFd, 1, 100) <= 0)
+                continue;
+            int fd = accept(listenFd, nullptr, nullptr);
+            if (fd < 0)
+            {
+                // E.g. out of file descriptors, wait for connections to be closed instead of spinning
+                if (errno != EINTR && errno != ECONNABORTED)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            uint64_t id = nextId++;
+            auto connection = std::make_shared<Connection>(fd);
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            connections[id] = connection;
+            connectionThreads[id] = std::thread([&, id](std::shared_ptr<Connection> threadConnection) {
+                serveConnection(std::move(threadConnection), requests, stats);
+                std::lock_guard<std::mutex> threadLock(connectionsMutex);
+                connections.erase(id);
+                finishedConnections.push_back(id);
+            }, std::move(connection));
+        }
+        // Wake up the connection threads blocked in receiving, and the batching below
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (auto & connection : connections)
+            shutdown(connection.second->getFd(), SHUT_RD);
+        requests.stop();
+    });
+
+    // Process the requests in batches until stopped
+    std::vector<PendingRequest> batch;
+    std::vector<Job> jobs;
+    while (requests.popBatch(maxBatch, batchWindow, batch))
+    {
+        jobs.clear();
+        for (auto const & pending : batch)
+        {
+            Request const & request = pending.request;
+            if (request.kernel == KernelKind::Grid)
+            {
+                // A full square grid, as a partially filled row would bias the result
+                uint32_t gridSide = getSquareRootFloor(request.n);
+                jobs.push_back(Job{request.seed, request.r, gridSide * gridSide, request.kernel, gridSide});
+            }
+            else
+                jobs.push_back(Job{request.seed, request.r, request.n, request.kernel, 1});
+        }
+        std::vector<uint32_t> counts = estimator.estimate(jobs);
+        stats.addBatch();
+        for (std::size_t job = 0; job < batch.size(); job++)
+        {
+            Response response{};
+            response.magic = responseMagic;
+            response.id = batch[job].request.id;
+            response.numInside = counts[job];
+            response.numPoints = jobs[job].n;
+            response.batchSize = static_cast<uint32_t>(batch.size());
+            response.pi = 4.0 * counts[job] / jobs[job].n;
+            batch[job].connection->send(response);
+            std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - batch[job].arrival;
+            stats.add(latency.count());
+        }
+        batch.clear();
+    }
+
+    acceptThread.join();
+    std::map<uint64_t, std::thread> remainingThreads;
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        remainingThreads.swap(connectionThreads);
+    }
+    for (auto & thread : remainingThreads)
+        thread.second.join();
+    close(listenFd);
+    unlink(socketPath.c_str());
+
+    Response summary{};
+    stats.fill(summary);
+    std::cout << "Served " << summary.numRequests << " requests in " << summary.numBatches << " launches, latency p50 "
+        << summary.p50Micros << " us, p99 " << summary.p99Micros << " us" << std::endl;
+
+    return 0;
+}
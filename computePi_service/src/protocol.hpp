@@ -0,0 +1,132 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Binary protocol of the estimation service over a Unix domain socket.
+// The client sends fixed-size requests and receives one fixed-size response per request,
+// in the order of the requests of its connection. As both ends run on the same host,
+// the structures are sent as they are, in host byte order.
+
+constexpr uint32_t requestMagic = 0x51524950; // "PIRQ"
+constexpr uint32_t responseMagic = 0x53524950; // "PIRS"
+
+enum class RequestType : uint32_t {
+    // Estimate Pi with the given parameters
+    Estimate = 0,
+    // Report the latency statistics of the service
+    Stats = 1,
+    // Stop the service after answering pending requests
+    Shutdown = 2
+};
+
+// Kernels the service can estimate Pi with
+enum class KernelKind : uint32_t {
+    // Points drawn from the random generator of the device with the given seed
+    Random = 0,
+    // Points at the centers of the cells of a square grid of floor(sqrt(n))^2 cells, the seed is ignored
+    Grid = 1
+};
+
+struct Request {
+    uint32_t magic;
+    RequestType type;
+    KernelKind kernel;
+    // Number of points and circle radius, the points are in [0, r] x [0, r]
+    uint32_t n;
+    float r;
+    uint32_t seed;
+    // Chosen by the client, returned in the response
+    uint64_t id;
+};
+
+struct Response {
+    uint32_t magic;
+    // 0 on success, otherwise an error number like EINVAL
+    int32_t status;
+    uint64_t id;
+    // Result of an estimation
+    uint32_t numInside;
+    // Number of points used, for the grid kernel the largest square number not above n
+    uint32_t numPoints;
+    double pi;
+    // Number of requests processed in the same launch as this one
+    uint32_t batchSize;
+    // Statistics of the service, for stats requests
+    uint32_t numBatches;
+    double p50Micros;
+    double p99Micros;
+    uint64_t numRequests;
+};
+
+static_assert(sizeof(Request) == 32, "Requests are sent as they are");
+static_assert(sizeof(Response) == 64, "Responses are sent as they are");
+
+// Fill the address of the socket at path, return false if the path is too long
+inline bool makeSocketAddress(std::string const & path, sockaddr_un & address)
+{
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+        return false;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+// Send all bytes, return false if the connection failed
+inline bool sendAll(int fd, void const * data, std::size_t bytes)
+{
+    auto const * ptr = static_cast<char const *>(data);
+    while (bytes > 0)
+    {
+        // Without MSG_NOSIGNAL, writing to a closed connection would kill the process
+        ssize_t result = send(fd, ptr, bytes, MSG_NOSIGNAL);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return false;
+        ptr += result;
+        bytes -= static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+// Receive exactly bytes bytes, return false if the connection was closed or failed
+inline bool receiveAll(int fd, void * data, std::size_t bytes)
+{
+    auto * ptr = static_cast<char *>(data);
+    while (bytes > 0)
+    {
+        ssize_t result = recv(fd, ptr, bytes, 0);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return false;
+        ptr += result;
+        bytes -= static_cast<std::size_t>(result);
+    }
+    return true;
+}
@@ -0,0 +1,202 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostWorkers.hpp"
+#include "startupProfiler.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// This example measures where the time of a short computePi run goes before its result is there.
+// Each step is timed separately, see startupProfiler.hpp, for a cold run in a fresh process
+// and a warm run repeating the steps, for every enabled back-end and two strategies:
+// - lazy: the input is generated first, and the runtime of the back-end starts its threads
+//   in the first kernel launch;
+// - eager: the device and the queue are set up first, and a host task in the non-blocking queue
+//   starts the threads of the runtime, while the host generates the input.
+// The thread of the queue runs the kernels as well, so they find the runtime started.
+// The runtimes keep their threads per host thread, e.g. an OpenMP team per thread starting
+// parallel regions, so the warm run reuses the queue of the cold run and with it the thread of the queue.
+
+// Kernel from the homework with striding and loop blocking, which counts the points inside
+struct CountInsideKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, float const * x, float const * y, float r, uint32_t n,
+        uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float d = math::sqrt(acc, x[i] * x[i] + y[i] * y[i]);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Run computePi twice with the given strategy and print the profiles
+template<typename Acc>
+int profileStartup(InitStrategy strategy, uint32_t n)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+    float r = 10.0f;
+
+    StartupProfiler cold;
+    StartupProfiler warm;
+    float pi = 0.0f;
+    using Queue = queue::Queue<Acc, queue::NonBlocking>;
+    std::unique_ptr<Queue> queueOfRuns;
+    for (uint32_t run = 0; run < 2; run++)
+    {
+        StartupProfiler & profiler = (run == 0) ? cold : warm;
+        profiler.restart();
+
+        // Generate input x, y randomly in [0, r]
+        std::vector<float> x(n);
+        std::vector<float> y(n);
+        auto generateInput = [&]() {
+            std::mt19937 generator;
+            std::uniform_real_distribution<float> distribution(0.0f, r);
+            for (auto idx = 0u; idx < n; idx++)
+            {
+                x[idx] = distribution(generator);
+                y[idx] = distribution(generator);
+            }
+            profiler.step("input generation");
+        };
+        if (strategy == InitStrategy::Lazy)
+            generateInput();
+
+        auto const numDevices = pltf::getDevCount<pltf::Pltf<dev::Dev<Acc>>>();
+        profiler.step("platform enumeration");
+        if (numDevices == 0)
+            return 1;
+        auto const device = pltf::getDevByIdx<Acc>(0u);
+        auto const devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+        profiler.step("getDevByIdx");
+        if (!queueOfRuns)
+            queueOfRuns = std::make_unique<Queue>(device);
+        Queue & queue = *queueOfRuns;
+        profiler.step("queue construction, reused warm");
+        if (strategy == InitStrategy::Eager)
+        {
+            queue::enqueue(queue, []() { RuntimeSpinUp<Acc>::run(); });
+            profiler.step("runtime spin-up enqueued");
+            generateInput();
+        }
+
+        vec::Vec<Dim, Idx> bufferExtent{n};
+        vec::Vec<Dim, Idx> countExtent{1u};
+        auto xBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+        auto yBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+        auto countBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, countExtent);
+        auto countBufferHost = mem::buf::alloc<uint32_t, Idx>(devHost, countExtent);
+        profiler.step("buffer allocation");
+
+        using HostView = mem::view::ViewPlainPtr<dev::DevCpu, float, Dim, Idx>;
+        HostView xView(x.data(), devHost, bufferExtent);
+        HostView yView(y.data(), devHost, bufferExtent);
+        mem::view::copy(queue, xBufferAcc, xView, bufferExtent);
+        mem::view::copy(queue, yBufferAcc, yView, bufferExtent);
+        mem::view::set(queue, countBufferAcc, 0u, countExtent);
+        alpaka::wait::wait(queue);
+        profiler.step("copies to device");
+
+        // One block per host thread, each processing a contiguous range of points
+        uint32_t blocksPerGrid = getNumHostWorkers();
+        uint32_t elementsPerThread = (n + blocksPerGrid - 1) / blocksPerGrid;
+        using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+        auto workDiv = WorkDiv{blocksPerGrid, 1u, elementsPerThread};
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, CountInsideKernel{},
+            mem::view::getPtrNative(xBufferAcc), mem::view::getPtrNative(yBufferAcc), r, n,
+            mem::view::getPtrNative(countBufferAcc));
+        profiler.step("kernel task creation");
+        queue::enqueue(queue, taskRunKernel);
+        mem::view::copy(queue, countBufferHost, countBufferAcc, countExtent);
+        alpaka::wait::wait(queue);
+        profiler.step("first enqueue and wait");
+        pi = 4.f * *mem::view::getPtrNative(countBufferHost) / n;
+    }
+    printStartupProfiles(acc::getAccName<Acc>() + ", " + getInitStrategyName(strategy)
+        + " initialization, computed pi is " + std::to_string(pi), cold, warm);
+    return 0;
+}
+
+// Profile both strategies in cold processes of their own
+template<typename Acc>
+bool profileBackEnd(uint32_t n)
+{
+    bool isOk = runForked([n]() { return profileStartup<Acc>(InitStrategy::Lazy, n); });
+    isOk &= runForked([n]() { return profileStartup<Acc>(InitStrategy::Eager, n); });
+    return isOk;
+}
+
+// Usage: computePi_startupProfile [n]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Number of points, small as in short-lived jobs
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    if (n == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [n], with n > 0\n";
+        return 1;
+    }
+
+    // This process does not use any back-end itself, so that every child starts cold
+    bool isOk = true;
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuSerial<Dim, Idx>>(n);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuOmp2Blocks<Dim, Idx>>(n);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuOmp2Threads<Dim, Idx>>(n);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuThreads<Dim, Idx>>(n);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuTbbBlocks<Dim, Idx>>(n);
+#endif
+
+    return isOk ? 0 : 1;
+}
@@ -0,0 +1,456 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "chunkReader.hpp"
+#include "hostWorkers.hpp"
+#include "pointDecoding.hpp"
+#include "pointFile.hpp"
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// This example processes point files of any size, also larger than memory,
+// by streaming over them in fixed-size chunks.
+// Each chunk is copied into one of a small ring of device buffers and classified
+// by a kernel counting the points inside, so the resident memory is bounded by
+// the chunk size and the ring size, independent of the size of the file.
+// The chunks are provided by one of the sources:
+// - mmap: the file is memory-mapped, while a chunk is processed the next one is read ahead
+//   with MADV_WILLNEED, and the pages of processed chunks are dropped with MADV_DONTNEED;
+// - io_uring: reads of all chunks in the ring are kept in flight with io_uring,
+//   optionally with direct I/O bypassing the page cache;
+// - pread: as io_uring, but with a pool of threads doing blocking reads.
+// The io_uring source falls back to pread where io_uring is not available.
+// Files with 16 bit encodings are streamed and copied encoded, and decoded by the kernel.
+// For files with chunk statistics, chunks lying entirely inside or outside the circle are
+// counted from their bounding boxes and never read, unless disabled with noskip.
+
+// Kernel from the homework with striding and loop blocking, which counts the points
+// inside instead of storing a flag per point and decodes the points with a decoder from pointDecoding.hpp
+struct CountInsideKernel {
+    template<typename Acc, typename Decoder>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, unsigned char const * x, unsigned char const * y,
+        Decoder decoder, float r, uint32_t n, uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        uint32_t threadElementExtent = workdiv::getWorkDiv<Thread, Elems>(acc)[0];
+
+        uint32_t threadCount = 0;
+        for (uint32_t idx = gridThreadIdx * threadElementExtent; idx < n;
+            idx += gridThreadExtent * threadElementExtent)
+        {
+            for (uint32_t i = idx; (i < idx + threadElementExtent) && (i < n); i++)
+            {
+                float xi = decoder(x, i);
+                float yi = decoder(y, i);
+                float d = math::sqrt(acc, xi * xi + yi * yi);
+                threadCount += (d <= r);
+            }
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Ring of device buffers, in which chunks are processed asynchronously to the host.
+// A slot can be used for the next chunk when the chunk processed in it is retired.
+template<typename Acc>
+class ChunkRing {
+public:
+    using Dim = alpaka::dim::Dim<Acc>;
+    using Idx = alpaka::idx::Idx<Acc>;
+    using Queue = alpaka::queue::Queue<Acc, alpaka::queue::NonBlocking>;
+
+    ChunkRing(uint32_t ringSize, std::size_t chunkBytes)
+        : m_device(alpaka::pltf::getDevByIdx<Acc>(0u)), m_devHost(alpaka::pltf::getDevByIdx<alpaka::dev::DevCpu>(0u)),
+          m_queue(m_device)
+    {
+        using namespace alpaka;
+        // One block per host thread, each processing a contiguous range of points of a chunk
+        m_blocksPerGrid = getNumHostWorkers();
+        vec::Vec<Dim, Idx> chunkExtent{static_cast<Idx>(chunkBytes)};
+        vec::Vec<Dim, Idx> countExtent{1u};
+        for (uint32_t slot = 0; slot < ringSize; slot++)
+        {
+            m_xBuffers.push_back(mem::buf::alloc<unsigned char, Idx>(m_device, chunkExtent));
+            m_yBuffers.push_back(mem::buf::alloc<unsigned char, Idx>(m_device, chunkExtent));
+            m_countBuffers.push_back(mem::buf::alloc<uint32_t, Idx>(m_device, countExtent));
+            m_countBuffersHost.push_back(mem::buf::alloc<uint32_t, Idx>(m_devHost, countExtent));
+            m_copyEvents.push_back(Event{m_device});
+            m_events.push_back(Event{m_device});
+        }
+    }
+
+    uint32_t getSize() const
+    {
+        return static_cast<uint32_t>(m_events.size());
+    }
+
+    // Enqueue copying the encoded columns of the chunk from host memory to the slot and classifying it
+    void enqueue(uint32_t slot, unsigned char const * x, unsigned char const * y, uint32_t chunkPoints,
+        PointFileHeader const & header)
+    {
+        using namespace alpaka;
+        vec::Vec<Dim, Idx> extent{chunkPoints * getPointBytes(header.encoding)};
+        vec::Vec<Dim, Idx> countExtent{1u};
+        // The views are only read from, as sources of copies
+        using HostView = mem::view::ViewPlainPtr<dev::DevCpu, unsigned char, Dim, Idx>;
+        HostView xView(const_cast<unsigned char *>(x), m_devHost, extent);
+        HostView yView(const_cast<unsigned char *>(y), m_devHost, extent);
+        mem::view::copy(m_queue, m_xBuffers[slot], xView, extent);
+        mem::view::copy(m_queue, m_yBuffers[slot], yView, extent);
+        queue::enqueue(m_queue, m_copyEvents[slot]);
+        mem::view::set(m_queue, m_countBuffers[slot], 0u, countExtent);
+        uint32_t elementsPerThread = (chunkPoints + m_blocksPerGrid - 1) / m_blocksPerGrid;
+        auto workDiv = workdiv::WorkDivMembers<Dim, Idx>{m_blocksPerGrid, 1u, elementsPerThread};
+        dispatchPointDecoder(header, chunkPoints, [&](auto decoder) {
+            auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, CountInsideKernel{},
+                mem::view::getPtrNative(m_xBuffers[slot]), mem::view::getPtrNative(m_yBuffers[slot]), decoder,
+                header.r, chunkPoints, mem::view::getPtrNative(m_countBuffers[slot]));
+            queue::enqueue(m_queue, taskRunKernel);
+        });
+        mem::view::copy(m_queue, m_countBuffersHost[slot], m_countBuffers[slot], countExtent);
+        queue::enqueue(m_queue, m_events[slot]);
+    }
+
+    // Wait until the host memory of the chunk in the slot may be reused
+    void waitCopied(uint32_t slot)
+    {
+        alpaka::wait::wait(m_copyEvents[slot]);
+    }
+
+    // Wait for the chunk in the slot and return the number of points inside
+    uint32_t retire(uint32_t slot)
+    {
+        alpaka::wait::wait(m_events[slot]);
+        return *alpaka::mem::view::getPtrNative(m_countBuffersHost[slot]);
+    }
+
+private:
+    using Event = alpaka::event::Event<Queue>;
+    using BufAccBytes = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, unsigned char, Dim, Idx>;
+    using BufAccCount = alpaka::mem::buf::Buf<alpaka::dev::Dev<Acc>, uint32_t, Dim, Idx>;
+    using BufHostCount = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, uint32_t, Dim, Idx>;
+
+    alpaka::dev::Dev<Acc> m_device;
+    alpaka::dev::DevCpu m_devHost;
+    Queue m_queue;
+    uint32_t m_blocksPerGrid;
+    std::vector<BufAccBytes> m_xBuffers;
+    std::vector<BufAccBytes> m_yBuffers;
+    std::vector<BufAccCount> m_countBuffers;
+    std::vector<BufHostCount> m_countBuffersHost;
+    std::vector<Event> m_copyEvents;
+    std::vector<Event> m_events;
+};
+
+// Contiguous range of points, which is processed as one chunk
+struct ChunkRange {
+    uint64_t first;
+    uint32_t count;
+};
+
+// Classification of all points in a bounding box
+enum class BoxClass {
+    Inside,
+    Outside,
+    Mixed
+};
+
+// Classify the box by its nearest and farthest points from the origin.
+// The distances are computed as in the kernel, so the result is exact for every point in the box.
+BoxClass classifyBox(ChunkStats const & stats, float r)
+{
+    float nearX = (stats.minX > 0.0f) ? stats.minX : ((stats.maxX < 0.0f) ? stats.maxX : 0.0f);
+    float nearY = (stats.minY > 0.0f) ? stats.minY : ((stats.maxY < 0.0f) ? stats.maxY : 0.0f);
+    float farX = std::max(std::fabs(stats.minX), std::fabs(stats.maxX));
+    float farY = std::max(std::fabs(stats.minY), std::fabs(stats.maxY));
+    if (std::sqrt(farX * farX + farY * farY) <= r)
+        return BoxClass::Inside;
+    if (!(std::sqrt(nearX * nearX + nearY * nearY) <= r))
+        return BoxClass::Outside;
+    return BoxClass::Mixed;
+}
+
+// Split the file into ranges of at most chunkSize points.
+// With chunk statistics, units of unitPoints points lying entirely inside or outside
+// are classified wholesale and left out of the ranges, so they are never read.
+// Their points are added to numInside and numSkipped.
+std::vector<ChunkRange> planRanges(PointFile const & file, uint32_t chunkSize, uint32_t unitPoints, bool useStats,
+    uint64_t & numInside, uint64_t & numSkipped)
+{
+    uint64_t const n = file.getNumPoints();
+    ChunkStats const * stats = useStats ? file.getChunkStats() : nullptr;
+    std::vector<ChunkRange> ranges;
+    numInside = 0;
+    numSkipped = 0;
+    if (!stats)
+    {
+        for (uint64_t first = 0; first < n; first += chunkSize)
+            ranges.push_back(ChunkRange{first, static_cast<uint32_t>(std::min<uint64_t>(chunkSize, n - first))});
+        return ranges;
+    }
+    // Units consist of whole statistics chunks, both are powers of two
+    uint32_t const statsPoints = file.getHeader().chunkPoints;
+    for (uint64_t first = 0; first < n; first += unitPoints)
+    {
+        uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(unitPoints, n - first));
+        BoxClass unitClass = classifyBox(stats[first / statsPoints], file.getHeader().r);
+        for (uint64_t statsFirst = first + statsPoints; statsFirst < first + count; statsFirst += statsPoints)
+            if (classifyBox(stats[statsFirst / statsPoints], file.getHeader().r) != unitClass)
+                unitClass = BoxClass::Mixed;
+        if (unitClass != BoxClass::Mixed)
+        {
+            numInside += (unitClass == BoxClass::Inside) ? count : 0;
+            numSkipped += count;
+            continue;
+        }
+        // Extend the last range if this unit follows it directly
+        ChunkRange * last = ranges.empty() ? nullptr : &ranges.back();
+        if (last && last->first + last->count == first && last->count + count <= chunkSize)
+            last->count += count;
+        else
+            ranges.push_back(ChunkRange{first, count});
+    }
+    return ranges;
+}
+
+// Stream over the ranges of the memory-mapped file and return the number of points inside
+template<typename Acc>
+uint64_t streamMapped(PointFile const & file, std::vector<ChunkRange> const & ranges, ChunkRing<Acc> & ring)
+{
+    uint64_t const numChunks = ranges.size();
+    uint32_t const ringSize = ring.getSize();
+    uint32_t const pointBytes = getPointBytes(file.getEncoding());
+    uint64_t P = 0;
+    // Wait for the chunk, add its count and drop its pages
+    auto retireChunk = [&](uint64_t chunk) {
+        P += ring.retire(static_cast<uint32_t>(chunk % ringSize));
+        file.advise(ranges[chunk].first, ranges[chunk].count, MADV_DONTNEED);
+    };
+
+    if (numChunks > 0)
+        file.advise(ranges[0].first, ranges[0].count, MADV_WILLNEED);
+    for (uint64_t chunk = 0; chunk < numChunks; chunk++)
+    {
+        if (chunk >= ringSize)
+            retireChunk(chunk - ringSize);
+        // Read the next chunk ahead, while this one is copied and classified
+        if (chunk + 1 < numChunks)
+            file.advise(ranges[chunk + 1].first, ranges[chunk + 1].count, MADV_WILLNEED);
+        uint64_t firstByte = ranges[chunk].first * pointBytes;
+        ring.enqueue(static_cast<uint32_t>(chunk % ringSize), file.getXData() + firstByte,
+            file.getYData() + firstByte, ranges[chunk].count, file.getHeader());
+    }
+    for (uint64_t chunk = (numChunks > ringSize) ? numChunks - ringSize : 0; chunk < numChunks; chunk++)
+        retireChunk(chunk);
+    return P;
+}
+
+// Stream over the ranges of the file with asynchronous reads into the buffers of the reader,
+// the x and y columns of a slot of the ring are read into buffers 2 * slot and 2 * slot + 1.
+// Returns 0, or the error number of a failed read.
+template<typename Acc>
+int streamRead(PointFile const & file, std::vector<ChunkRange> const & ranges, ChunkRing<Acc> & ring,
+    ChunkReader & reader, uint64_t & P)
+{
+    uint64_t const numChunks = ranges.size();
+    uint32_t const ringSize = ring.getSize();
+    uint32_t const pointBytes = getPointBytes(file.getEncoding());
+    std::vector<uint32_t> numPendingReads(ringSize, 0);
+    std::vector<std::size_t> slotBytes(ringSize, 0);
+    auto submitChunk = [&](uint64_t chunk) {
+        uint32_t slot = static_cast<uint32_t>(chunk % ringSize);
+        uint64_t firstByte = ranges[chunk].first * pointBytes;
+        std::size_t bytes = std::size_t{ranges[chunk].count} * pointBytes;
+        numPendingReads[slot] = 2;
+        slotBytes[slot] = bytes;
+        return reader.submit(2 * slot, file.getHeader().xOffset + firstByte, bytes)
+            && reader.submit(2 * slot + 1, file.getHeader().yOffset + firstByte, bytes);
+    };
+
+    P = 0;
+    for (uint64_t chunk = 0; chunk < std::min<uint64_t>(ringSize, numChunks); chunk++)
+        if (!submitChunk(chunk))
+            return EIO;
+    for (uint64_t chunk = 0; chunk < numChunks; chunk++)
+    {
+        uint32_t slot = static_cast<uint32_t>(chunk % ringSize);
+        uint32_t chunkPoints = ranges[chunk].count;
+        // Reads complete in any order, also those of later chunks in other slots,
+        // wait until both columns of this chunk are there
+        while (numPendingReads[slot] > 0)
+        {
+            ReadCompletion completion = reader.wait();
+            if (completion.result < 0)
+                return static_cast<int>(-completion.result);
+            uint32_t completedSlot = completion.buffer / 2;
+            if (static_cast<uint64_t>(completion.result) < slotBytes[completedSlot])
+                return EIO;
+            numPendingReads[completedSlot]--;
+        }
+        if (chunk >= ringSize)
+            P += ring.retire(slot);
+        ring.enqueue(slot, static_cast<unsigned char const *>(reader.getBuffer(2 * slot)),
+            static_cast<unsigned char const *>(reader.getBuffer(2 * slot + 1)), chunkPoints, file.getHeader());
+        // Reuse the buffers for the chunk which comes next in this slot
+        if (chunk + ringSize < numChunks)
+        {
+            ring.waitCopied(slot);
+            if (!submitChunk(chunk + ringSize))
+                return EIO;
+        }
+    }
+    for (uint64_t chunk = (numChunks > ringSize) ? numChunks - ringSize : 0; chunk < numChunks; chunk++)
+        P += ring.retire(static_cast<uint32_t>(chunk % ringSize));
+    return 0;
+}
+
+// Peak resident memory of the process so far, in MiB
+double getPeakRssMiB()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+// Usage: computePi_streaming <file> [pointsPerChunk] [mmap|io_uring|pread] [direct] [noskip]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <file> [pointsPerChunk] [mmap|io_uring|pread] [direct] [noskip],"
+            << " files are created with writePoints\n";
+        return 1;
+    }
+    auto file = PointFile::open(argv[1]);
+    if (!file)
+    {
+        std::cerr << file.getError() << "\n";
+        return 1;
+    }
+    uint64_t n = file.getNumPoints();
+    char const * source = (argc > 3) ? argv[3] : "mmap";
+    bool isDirect = false;
+    bool useStats = true;
+    for (int arg = 4; arg < argc; arg++)
+    {
+        isDirect = isDirect || (std::strcmp(argv[arg], "direct") == 0);
+        useStats = useStats && (std::strcmp(argv[arg], "noskip") != 0);
+    }
+    useStats = useStats && file.getChunkStats();
+
+    // Chunks start at page boundaries of the columns, as required for direct I/O,
+    // and at chunk boundaries of shuffled files and statistics, all are powers of two
+    uint32_t const pointBytes = getPointBytes(file.getEncoding());
+    uint32_t chunkAlignment = static_cast<uint32_t>(chunkReaderAlignment / pointBytes);
+    if (file.getEncoding() == PointEncoding::Fixed16Shuffled || useStats)
+        chunkAlignment = std::max(chunkAlignment, file.getHeader().chunkPoints);
+    // Columns of a chunk are at most 1 GiB, so that their sizes fit into 32 bit indices
+    // and are read with a single system call, which transfers less than 2 GiB
+    uint64_t const maxChunkBytes = uint64_t{1} << 30;
+    uint64_t const alignmentBytes = uint64_t{chunkAlignment} * pointBytes;
+    if (alignmentBytes > maxChunkBytes)
+    {
+        std::cerr << "Chunks of " << chunkAlignment << " points of the file are larger than " << maxChunkBytes
+            << " bytes per column\n";
+        return 1;
+    }
+    uint64_t numChunkUnits = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : (1u << 22);
+    numChunkUnits = std::max<uint64_t>((numChunkUnits + chunkAlignment - 1) / chunkAlignment, 1u);
+    numChunkUnits = std::min(numChunkUnits, maxChunkBytes / alignmentBytes);
+    uint32_t const chunkSize = static_cast<uint32_t>(numChunkUnits * chunkAlignment);
+    std::size_t const chunkBytes = std::size_t{chunkSize} * pointBytes;
+
+    // Four slots, so that reads of the next chunks are in flight while a chunk is copied and another classified
+    uint32_t const ringSize = 4;
+    ChunkRing<Acc> ring(ringSize, chunkBytes);
+    std::unique_ptr<ChunkReader> reader;
+    if (std::strcmp(source, "mmap") != 0)
+    {
+        bool const useIoUring = std::strcmp(source, "io_uring") == 0;
+        if (!useIoUring && std::strcmp(source, "pread") != 0)
+        {
+            std::cerr << "Unknown source " << source << ", use one of mmap, io_uring, pread\n";
+            return 1;
+        }
+        reader = createChunkReader(argv[1], 2 * ringSize, chunkBytes, isDirect, useIoUring);
+        if (!reader)
+        {
+            std::cerr << "Cannot open " << argv[1] << (isDirect ? " for direct I/O" : "") << "\n";
+            return 1;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t numInsideSkipped = 0;
+    uint64_t numSkipped = 0;
+    auto ranges = planRanges(file, chunkSize, chunkAlignment, useStats, numInsideSkipped, numSkipped);
+    uint64_t P = 0;
+    if (reader)
+    {
+        int error = streamRead(file, ranges, ring, *reader, P);
+        if (error != 0)
+        {
+            std::cerr << "Reading " << argv[1] << " failed: " << std::strerror(error) << "\n";
+            return 1;
+        }
+    }
+    else
+        P = streamMapped(file, ranges, ring);
+    P += numInsideSkipped;
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    double pi = (n > 0) ? 4.0 * P / n : 0.0;
+
+    // Output results, throughput refers to the encoded coordinates of the whole file, including skipped chunks
+    double bytes = static_cast<double>(n) * 2 * pointBytes;
+    std::cout << "Computed pi is " << pi << " from " << n << " points encoded as "
+        << getPointEncodingName(file.getEncoding()) << " in " << ranges.size() << " chunks of up to "
+        << chunkSize << " points, source: " << (reader ? reader->getName() : "mmap")
+        << (reader && reader->isDirect() ? ", direct I/O" : "") << "\n";
+    if (useStats)
+        std::cout << "Skipped by chunk statistics: " << numSkipped << " points ("
+            << (n > 0 ? 100.0 * numSkipped / n : 0.0) << "%)\n";
+    std::cout << "Execution time: " << duration.count() << " s, " << bytes / duration.count() * 1e-9
+        << " GB/s, peak RSS: " << getPeakRssMiB() << " MiB for " << bytes / (1024 * 1024) << " MiB of points"
+        << std::endl;
+
+    return 0;
+}
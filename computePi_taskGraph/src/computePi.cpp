@@ -0,0 +1,193 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostWorkers.hpp"
+#include "taskGraph.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+// This example repeats a small estimation of pi many times with different random streams,
+// as tight loops of repeated estimations do.
+// Each estimation copies its parameters to the device, resets the counter, runs the kernel
+// and copies the count back. Done as usual, the copy tasks, the work division and the kernel task
+// are created anew on every iteration. With a task graph, see taskGraph.hpp, the sequence is
+// recorded once and only replayed, the parameters are updated in host memory between replays.
+// Both ways are timed with the same random streams, and their counts have to be equal.
+
+// Parameters which change between estimations
+struct Parameters {
+    // Seed of the random number generator
+    uint32_t seed;
+    // Subsequence of the random stream of the first thread, the others follow.
+    // Estimations use disjoint subsequences of a stream, as streams with different seeds
+    // are not guaranteed to be independent
+    uint32_t firstSubsequence;
+    // Circle radius, points are generated in [0, r]
+    float r;
+};
+
+// Each thread generates and classifies points with a strided loop, with its own
+// subsequence of the random stream, and adds the number of points inside to the counter
+struct EstimateKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, Parameters const * parameters, uint32_t n, uint32_t * count) const
+    {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        float const r = parameters->r;
+        auto generator = rand::generator::createDefault(acc, parameters->seed,
+            parameters->firstSubsequence + gridThreadIdx);
+        auto distribution = rand::distribution::createUniformReal<float>(acc);
+        uint32_t threadCount = 0;
+        for (uint32_t i = gridThreadIdx; i < n; i += gridThreadExtent)
+        {
+            float x = r * distribution(generator);
+            float y = r * distribution(generator);
+            float d = math::sqrt(acc, x * x + y * y);
+            threadCount += (d <= r);
+        }
+        atomic::atomicOp<atomic::op::Add>(acc, count, threadCount);
+    }
+};
+
+// Usage: computePi_taskGraph [n] [numIterations]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    // Number of points per estimation, small so that the setup of an iteration matters
+    uint32_t n = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 4096;
+    uint32_t numIterations = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 10000;
+    if (n == 0 || numIterations == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [n] [numIterations], with n > 0 and numIterations > 0\n";
+        return 1;
+    }
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    auto const devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    vec::Vec<Dim, Idx> singleExtent{1u};
+    auto parametersBufferHost = mem::buf::alloc<Parameters, Idx>(devHost, singleExtent);
+    auto countBufferHost = mem::buf::alloc<uint32_t, Idx>(devHost, singleExtent);
+    auto parametersBufferAcc = mem::buf::alloc<Parameters, Idx>(device, singleExtent);
+    auto countBufferAcc = mem::buf::alloc<uint32_t, Idx>(device, singleExtent);
+    Parameters * parameters = mem::view::getPtrNative(parametersBufferHost);
+    uint32_t * count = mem::view::getPtrNative(countBufferHost);
+
+    // One block per host thread with a single thread
+    uint32_t blocksPerGrid = std::min(getNumHostWorkers(), n);
+    uint32_t const seed = 2020;
+    if (static_cast<uint64_t>(numIterations) * blocksPerGrid > std::numeric_limits<uint32_t>::max())
+    {
+        std::cerr << "Too many iterations for disjoint subsequences of the random stream\n";
+        return 1;
+    }
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    float const r = 10.0f;
+    std::vector<uint32_t> counts(numIterations);
+    std::vector<uint32_t> graphCounts(numIterations);
+
+    // As usual: tasks created on every iteration
+    auto runIterations = [&]() {
+        for (uint32_t iteration = 0; iteration < numIterations; iteration++)
+        {
+            *parameters = Parameters{seed, iteration * blocksPerGrid, r};
+            mem::view::copy(queue, parametersBufferAcc, parametersBufferHost, singleExtent);
+            mem::view::set(queue, countBufferAcc, 0u, singleExtent);
+            auto workDiv = WorkDiv{blocksPerGrid, 1u, 1u};
+            auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, EstimateKernel{},
+                mem::view::getPtrNative(parametersBufferAcc), n, mem::view::getPtrNative(countBufferAcc));
+            queue::enqueue(queue, taskRunKernel);
+            mem::view::copy(queue, countBufferHost, countBufferAcc, singleExtent);
+            alpaka::wait::wait(queue);
+            counts[iteration] = *count;
+        }
+    };
+
+    // With a task graph: the same sequence recorded once
+    TaskGraph<Queue> graph;
+    graph.addCopy(parametersBufferAcc, parametersBufferHost, singleExtent);
+    graph.addSet(countBufferAcc, 0u, singleExtent);
+    graph.addTask(kernel::createTaskKernel<Acc>(WorkDiv{blocksPerGrid, 1u, 1u}, EstimateKernel{},
+        mem::view::getPtrNative(parametersBufferAcc), n, mem::view::getPtrNative(countBufferAcc)));
+    graph.addCopy(countBufferHost, countBufferAcc, singleExtent);
+    auto replayIterations = [&]() {
+        for (uint32_t iteration = 0; iteration < numIterations; iteration++)
+        {
+            *parameters = Parameters{seed, iteration * blocksPerGrid, r};
+            graph.replay(queue);
+            alpaka::wait::wait(queue);
+            graphCounts[iteration] = *count;
+        }
+    };
+
+    // Best of several runs, after an untimed one, e.g. for starting up the OpenMP runtime
+    auto measure = [](auto && run) {
+        run();
+        uint32_t numRepetitions = 5;
+        double bestDuration = 0.0;
+        for (uint32_t repetition = 0; repetition < numRepetitions; repetition++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            run();
+            std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+            if (repetition == 0 || duration.count() < bestDuration)
+                bestDuration = duration.count();
+        }
+        return bestDuration;
+    };
+    double duration = measure(runIterations);
+    double graphDuration = measure(replayIterations);
+
+    uint64_t P = 0;
+    for (uint32_t iteration = 0; iteration < numIterations; iteration++)
+        P += counts[iteration];
+    float pi = 4.f * P / (static_cast<uint64_t>(n) * numIterations);
+
+    // Output results
+    std::cout << "Computed pi is " << pi << " from " << numIterations << " estimations of " << n << " points\n";
+    std::cout << "Tasks created per iteration: " << duration << " ms, " << duration * 1000.0 / numIterations
+        << " us per iteration\n";
+    std::cout << "Task graph of " << graph.getNumNodes() << " operations replayed: " << graphDuration << " ms, "
+        << graphDuration * 1000.0 / numIterations << " us per iteration\n";
+    if (counts != graphCounts)
+    {
+        std::cout << "Error: the counts of the task graph differ\n";
+        return 1;
+    }
+
+    return 0;
+}
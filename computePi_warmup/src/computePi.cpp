@@ -0,0 +1,217 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <type_traits>
+
+// This example is lesson 26 with the time measurement restricted to the steady state.
+// In lesson 26 the first copy goes into freshly allocated device memory,
+// so the measured time includes page faults on the first touch.
+// Here all buffers are pre-faulted (and optionally locked in memory) and one
+// untimed iteration is run before the measurement.
+// The number of page faults is reported for every phase of the program.
+
+// Structure with memory buffers for inputs (x, y) and
+// outputs (inside) of the kernel
+struct Points {
+    float * x;
+    float * y;
+    bool * inside;
+};
+
+// Kernel as in lesson 26
+struct PixelFinderKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc,
+        Points points, float r) const {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        float x = points.x[gridThreadIdx];
+        float y = points.y[gridThreadIdx];
+        float d = math::sqrt(acc, x * x + y * y);
+        bool isInside = (d <= r);
+        points.inside[gridThreadIdx] = isInside;
+    }
+};
+
+// Counts of minor and major page faults of the process so far
+struct PageFaults {
+    long minor;
+    long major;
+};
+
+PageFaults getPageFaults()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return {usage.ru_minflt, usage.ru_majflt};
+}
+
+// Print page faults since the previous phase and start a new phase
+void reportPhase(char const * name, PageFaults & previous)
+{
+    PageFaults current = getPageFaults();
+    std::cout << std::setw(24) << std::left << name << std::right << " minor faults: " << std::setw(8)
+        << current.minor - previous.minor << ", major faults: " << current.major - previous.major << "\n";
+    previous = current;
+}
+
+// Lock the memory of a buffer, return false if not permitted (e.g. due to RLIMIT_MEMLOCK)
+template<typename Buf>
+bool lockBuffer(Buf & buffer, std::size_t numElements)
+{
+    auto * ptr = alpaka::mem::view::getPtrNative(buffer);
+    return mlock(ptr, numElements * sizeof(*ptr)) == 0;
+}
+
+// Usage: computePi_warmup [--mlock]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    bool useMlock = (argc > 1) && (std::strcmp(argv[1], "--mlock") == 0);
+    PageFaults pageFaults = getPageFaults();
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+    reportPhase("device and queue", pageFaults);
+
+    // Number of points
+    uint32_t n = 10000000;
+
+    // Circle radius
+    float r = 10.0f;
+
+    auto devHost = pltf::getDevByIdx<dev::DevCpu>(0u);
+    vec::Vec<Dim, Idx> bufferExtent{n};
+    auto xBufferHost = mem::buf::alloc<float, Idx>(devHost, bufferExtent);
+    auto yBufferHost = mem::buf::alloc<float, Idx>(devHost, bufferExtent);
+    auto insideBufferHost = mem::buf::alloc<bool, Idx>(devHost, bufferExtent);
+    auto xBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto yBufferAcc = mem::buf::alloc<float, Idx>(device, bufferExtent);
+    auto insideBufferAcc = mem::buf::alloc<bool, Idx>(device, bufferExtent);
+    reportPhase("allocation", pageFaults);
+
+    Points pointsHost;
+    pointsHost.x = mem::view::getPtrNative(xBufferHost);
+    pointsHost.y = mem::view::getPtrNative(yBufferHost);
+    pointsHost.inside = mem::view::getPtrNative(insideBufferHost);
+    Points pointsAcc;
+    pointsAcc.x = mem::view::getPtrNative(xBufferAcc);
+    pointsAcc.y = mem::view::getPtrNative(yBufferAcc);
+    pointsAcc.inside = mem::view::getPtrNative(insideBufferAcc);
+
+    // Generate input x, y randomly in [0, r]
+    std::random_device rd;
+    std::mt19937 generator{rd()};
+    std::uniform_real_distribution<float> distribution(0.0f, r);
+    for (auto idx = 0u; idx < n; idx++)
+    {
+        pointsHost.x[idx] = distribution(generator);
+        pointsHost.y[idx] = distribution(generator);
+    }
+    reportPhase("host initialization", pageFaults);
+
+    // Pre-fault all pages not touched yet by writing to them,
+    // for device buffers this is done on the device side
+    std::memset(pointsHost.inside, 0, n * sizeof(bool));
+    mem::view::set(queue, xBufferAcc, 0u, bufferExtent);
+    mem::view::set(queue, yBufferAcc, 0u, bufferExtent);
+    mem::view::set(queue, insideBufferAcc, 0u, bufferExtent);
+    alpaka::wait::wait(queue);
+
+    // Optionally lock the buffers, so that they are not swapped out later.
+    // Device buffers are in host memory only for CPU accelerators.
+    if (useMlock)
+    {
+        bool isLocked = lockBuffer(xBufferHost, n) && lockBuffer(yBufferHost, n) && lockBuffer(insideBufferHost, n);
+        if (std::is_same<dev::Dev<Acc>, dev::DevCpu>::value)
+            isLocked = isLocked && lockBuffer(xBufferAcc, n) && lockBuffer(yBufferAcc, n)
+                && lockBuffer(insideBufferAcc, n);
+        if (!isLocked)
+            std::cout << "Warning: locking buffers failed, continuing without\n";
+    }
+    reportPhase("pre-faulting", pageFaults);
+
+    uint32_t blocksPerGrid = n;
+    uint32_t threadsPerBlock = 1;
+    uint32_t elementsPerThread = 1;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+    PixelFinderKernel pixelFinderKernel;
+
+    // Same sequence of operations as in lesson 26
+    auto runIteration = [&]() {
+        mem::view::copy(queue, xBufferAcc, xBufferHost, bufferExtent);
+        mem::view::copy(queue, yBufferAcc, yBufferHost, bufferExtent);
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, pixelFinderKernel, pointsAcc, r);
+        queue::enqueue(queue, taskRunKernel);
+        mem::view::copy(queue, insideBufferHost, insideBufferAcc, bufferExtent);
+        alpaka::wait::wait(queue);
+        uint32_t P = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            if (pointsHost.inside[i])
+                ++P;
+        }
+        return 4.f * P / n;
+    };
+
+    // Untimed warm-up iteration, e.g. for starting up the OpenMP runtime
+    runIteration();
+    reportPhase("warm-up iteration", pageFaults);
+
+    // Timed iterations in the steady state
+    uint32_t numIterations = 10;
+    float pi = 0.0f;
+    double minDuration = 0.0;
+    double totalDuration = 0.0;
+    for (uint32_t iteration = 0; iteration < numIterations; iteration++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        pi = runIteration();
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        totalDuration += duration.count();
+        if (iteration == 0 || duration.count() < minDuration)
+            minDuration = duration.count();
+    }
+    reportPhase("timed iterations", pageFaults);
+
+    // Output results
+    std::cout << "Computed pi is " << pi << "\n";
+    std::cout << "Execution time: " << totalDuration / numIterations << " ms on average, "
+        << minDuration << " ms minimum over " << numIterations << " iterations" << std::endl;
+
+    return 0;
+}
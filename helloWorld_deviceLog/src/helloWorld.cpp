@@ -0,0 +1,121 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "deviceLog.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// This example is helloWorld with the greetings written to a device log, see deviceLog.hpp,
+// instead of printed with printf by every thread.
+// The host formats the log after the kernel, optionally sorted by block and thread.
+// For comparison the kernel can print with printf as before.
+// The times are reported to stderr, so that the greetings can be redirected, e.g. to /dev/null,
+// and both ways compared without the terminal in the measurement.
+
+// Ids of the log formats, indexing logFormats
+enum LogFormatId : uint32_t {
+    helloFormatId
+};
+
+std::vector<char const *> const logFormats = {"Hello, World from alpaka thread %u out of %u!"};
+
+// Kernel of helloWorld, greeting either with the log or with printf
+struct HelloWorldKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, DeviceLog log, bool isLogged) const {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        if (isLogged)
+            log.append(acc, helloFormatId, gridThreadIdx, gridThreadExtent);
+        else
+            printf("Hello, World from alpaka thread %u out of %u!\n", gridThreadIdx, gridThreadExtent);
+    }
+};
+
+// Usage: helloWorld_deviceLog [log|sorted|printf] [blocks] [threadsPerBlock]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // Define alpaka accelerator type, which corresponds to the underlying programming model
+    using Acc = acc::AccCpuOmp2Blocks<Dim, Idx>;
+
+    char const * mode = (argc > 1) ? argv[1] : "log";
+    bool isLogged = (std::strcmp(mode, "printf") != 0);
+    bool isSorted = (std::strcmp(mode, "sorted") == 0);
+    Idx blocksPerGrid = (argc > 2) ? static_cast<Idx>(std::strtoul(argv[2], nullptr, 10)) : 1024;
+    Idx threadsPerBlock = (argc > 3) ? static_cast<Idx>(std::strtoul(argv[3], nullptr, 10)) : 1;
+    if ((isLogged && !isSorted && std::strcmp(mode, "log") != 0) || blocksPerGrid == 0 || threadsPerBlock == 0
+        || static_cast<uint64_t>(blocksPerGrid) * threadsPerBlock > (1u << 31))
+    {
+        std::cerr << "Usage: " << argv[0] << " [log|sorted|printf] [blocks] [threadsPerBlock], "
+            << "with up to 2^31 threads\n";
+        return 1;
+    }
+
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    using Queue = queue::Queue<Acc, queue::Blocking>;
+    auto queue = Queue{device};
+
+    // Only as many threads per block as the accelerator supports
+    auto const devProps = acc::getAccDevProps<Acc>(device);
+    threadsPerBlock = std::min(threadsPerBlock, static_cast<Idx>(devProps.m_blockThreadExtentMax[0]));
+    Idx elementsPerThread = 1;
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{blocksPerGrid, threadsPerBlock, elementsPerThread};
+
+    // Room for the greeting of every thread
+    DeviceLogBuffer<dev::Dev<Acc>, Idx> logBuffer(device, blocksPerGrid * threadsPerBlock);
+    logBuffer.clear(queue);
+    alpaka::wait::wait(queue);
+
+    auto start = std::chrono::steady_clock::now();
+    auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, HelloWorldKernel{}, logBuffer.getDeviceLog(), isLogged);
+    queue::enqueue(queue, taskRunKernel);
+    alpaka::wait::wait(queue);
+    std::chrono::duration<double, std::milli> kernelDuration = std::chrono::steady_clock::now() - start;
+
+    if (!isLogged)
+    {
+        std::fflush(stdout);
+        std::cerr << "Kernel with printf: " << kernelDuration.count() << " ms\n";
+        return 0;
+    }
+    start = std::chrono::steady_clock::now();
+    LogDrainResult result = logBuffer.drain(queue, logFormats, isSorted, std::cout);
+    std::cout.flush();
+    std::chrono::duration<double, std::milli> drainDuration = std::chrono::steady_clock::now() - start;
+    std::cerr << "Kernel with device log: " << kernelDuration.count() << " ms, draining and formatting "
+        << result.numRecords << " records" << (isSorted ? " sorted" : "") << ": " << drainDuration.count()
+        << " ms, dropped records: " << result.numDropped << "\n";
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// This example measures the cost of launching a kernel that does nothing.
+// The kernel is helloWorld without printing, so all that is measured is the launch:
+// creating the task, enqueueing it, running the empty blocks and threads and waiting.
+// For every enabled back-end, grid sizes from 1 to 10^6 blocks, threads per block from 1
+// to 1024 as far as the back-end allows, and blocking and non-blocking queues it reports
+// - percentiles of the latency of a launch followed by a wait, timed one by one;
+// - the mean time per launch when the launches are enqueued back to back and waited for once.
+// From the 50th percentiles it estimates the fixed cost of a launch and the cost per block.
+// A small job is worth batching with others when its own work is not much larger than the fixed cost.
+
+// Kernel of helloWorld without printing
+struct EmptyHelloWorldKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const &) const {
+    }
+};
+
+// Options of the measurement
+struct Options {
+    // Maximum number of launches per configuration
+    uint32_t maxLaunches;
+    // Time after which a configuration stops launching, if it already has minLaunches
+    double secondsPerConfig;
+    uint32_t minLaunches;
+    // Configurations with more threads in the grid are skipped
+    uint64_t maxGridThreads;
+};
+
+// Latencies of the launches of one configuration, in microseconds
+struct LaunchStats {
+    uint32_t blocks;
+    uint32_t threads;
+    uint32_t numLaunches;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+    double pipelined;
+};
+
+// Return the given percentile of sorted latencies
+double getPercentile(std::vector<double> const & sortedLatencies, double fraction)
+{
+    if (sortedLatencies.empty())
+        return 0.0;
+    return sortedLatencies[static_cast<std::size_t>(fraction * (sortedLatencies.size() - 1))];
+}
+
+// Launch the empty kernel with the given work division on a queue of the given kind
+template<typename Acc, typename QueueKind>
+LaunchStats measureLaunches(alpaka::dev::Dev<Acc> const & device, uint32_t blocks, uint32_t threads, Options const & options)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+    using Queue = queue::Queue<Acc, QueueKind>;
+    auto queue = Queue{device};
+    using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+    auto workDiv = WorkDiv{static_cast<Idx>(blocks), static_cast<Idx>(threads), Idx{1}};
+    using Clock = std::chrono::steady_clock;
+
+    // Launches one by one, each followed by a wait, a blocking queue has finished by then already
+    std::vector<double> latencies;
+    latencies.reserve(std::min(options.maxLaunches, 1u << 16));
+    auto const start = Clock::now();
+    for (uint32_t launch = 0; launch < options.maxLaunches; launch++)
+    {
+        auto launchStart = Clock::now();
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, EmptyHelloWorldKernel{});
+        queue::enqueue(queue, taskRunKernel);
+        alpaka::wait::wait(queue);
+        auto launchEnd = Clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(launchEnd - launchStart).count());
+        if (launch + 1 >= options.minLaunches
+            && std::chrono::duration<double>(launchEnd - start).count() > options.secondsPerConfig)
+            break;
+    }
+    uint32_t numLaunches = static_cast<uint32_t>(latencies.size());
+
+    // The same number of launches back to back, with a single wait
+    auto const pipelinedStart = Clock::now();
+    for (uint32_t launch = 0; launch < numLaunches; launch++)
+    {
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, EmptyHelloWorldKernel{});
+        queue::enqueue(queue, taskRunKernel);
+    }
+    alpaka::wait::wait(queue);
+    std::chrono::duration<double, std::micro> pipelinedDuration = Clock::now() - pipelinedStart;
+
+    std::sort(latencies.begin(), latencies.end());
+    LaunchStats stats;
+    stats.blocks = blocks;
+    stats.threads = threads;
+    stats.numLaunches = numLaunches;
+    stats.p50 = getPercentile(latencies, 0.5);
+    stats.p90 = getPercentile(latencies, 0.9);
+    stats.p99 = getPercentile(latencies, 0.99);
+    stats.max = latencies.back();
+    stats.pipelined = pipelinedDuration.count() / numLaunches;
+    return stats;
+}
+
+// Measure all configurations on a queue of the given kind and print the results
+template<typename Acc, typename QueueKind>
+void benchmarkQueue(std::string const & queueName, Options const & options)
+{
+    using namespace alpaka;
+    auto const device = pltf::getDevByIdx<Acc>(0u);
+    auto const devProps = acc::getAccDevProps<Acc>(device);
+    uint64_t maxBlocks = static_cast<uint64_t>(devProps.m_gridBlockCountMax);
+    uint64_t maxThreads = static_cast<uint64_t>(devProps.m_blockThreadCountMax);
+
+    std::cout << "  " << queueName << " queue\n";
+    std::cout << "    " << std::setw(8) << "blocks" << std::setw(9) << "threads" << std::setw(10) << "launches"
+        << std::setw(10) << "p50 us" << std::setw(10) << "p90 us" << std::setw(10) << "p99 us"
+        << std::setw(11) << "max us" << std::setw(14) << "pipelined us" << "\n";
+    for (uint32_t threads = 1; threads <= 1024 && threads <= maxThreads; threads *= 4)
+    {
+        // The launch of a single block is the fixed cost, the largest grid gives the cost per block
+        LaunchStats first{};
+        LaunchStats last{};
+        for (uint32_t blocks = 1; blocks <= 1000000 && blocks <= maxBlocks; blocks *= 10)
+        {
+            if (static_cast<uint64_t>(blocks) * threads > options.maxGridThreads)
+                break;
+            auto stats = measureLaunches<Acc, QueueKind>(device, blocks, threads, options);
+            std::cout << "    " << std::setw(8) << stats.blocks << std::setw(9) << stats.threads
+                << std::setw(10) << stats.numLaunches << std::setw(10) << stats.p50 << std::setw(10) << stats.p90
+                << std::setw(10) << stats.p99 << std::setw(11) << stats.max << std::setw(14) << stats.pipelined
+                << "\n";
+            if (blocks == 1)
+                first = stats;
+            last = stats;
+        }
+        if (last.blocks > 1)
+        {
+            double perBlock = std::max(0.0, (last.p50 - first.p50) / (last.blocks - 1));
+            std::cout << "    " << threads << " threads per block: fixed cost " << first.p50
+                << " us per launch, " << perBlock * 1000.0 << " ns per block\n";
+        }
+    }
+}
+
+// Measure both kinds of queues for the given accelerator
+template<typename Acc>
+void benchmarkBackEnd(Options const & options)
+{
+    using namespace alpaka;
+    std::cout << acc::getAccName<Acc>() << "\n";
+    benchmarkQueue<Acc, queue::Blocking>("Blocking", options);
+    benchmarkQueue<Acc, queue::NonBlocking>("NonBlocking", options);
+}
+
+// Usage: helloWorld_launchOverhead [maxLaunches] [secondsPerConfig] [maxGridThreads]
+int main(int argc, char * argv[]) {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    Options options;
+    options.maxLaunches = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    options.secondsPerConfig = (argc > 2) ? std::strtod(argv[2], nullptr) : 0.5;
+    options.minLaunches = std::min(options.maxLaunches, 10u);
+    options.maxGridThreads = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : (1ull << 24);
+    if (options.maxLaunches == 0 || options.secondsPerConfig < 0.0 || options.maxGridThreads == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [maxLaunches] [secondsPerConfig] [maxGridThreads], "
+            << "with maxLaunches > 0 and maxGridThreads > 0\n";
+        return 1;
+    }
+    std::cout << "Up to " << options.maxLaunches << " launches or " << options.secondsPerConfig
+        << " s per configuration, grids of up to " << options.maxGridThreads << " threads\n";
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    benchmarkBackEnd<acc::AccCpuSerial<Dim, Idx>>(options);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    benchmarkBackEnd<acc::AccCpuOmp2Blocks<Dim, Idx>>(options);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+    benchmarkBackEnd<acc::AccCpuOmp2Threads<Dim, Idx>>(options);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    benchmarkBackEnd<acc::AccCpuThreads<Dim, Idx>>(options);
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    benchmarkBackEnd<acc::AccCpuTbbBlocks<Dim, Idx>>(options);
+#endif
+
+    return 0;
+}
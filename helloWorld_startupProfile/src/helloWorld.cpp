@@ -0,0 +1,127 @@
+/* Copyright 2026 alpaka-group
+ *
+ * This file exemplifies usage of Alpaka.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS” AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL ISC BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+ * IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include "hostWorkers.hpp"
+#include "startupProfiler.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// This example measures what happens before the first kernel of helloWorld runs.
+// Each step is timed separately, see startupProfiler.hpp, for a cold run in a fresh
+// process and a warm run repeating the steps, for every enabled back-end and both
+// the lazy and the eager initialization of its runtime.
+
+// Kernel of helloWorld, only one thread greets, so that printing does not dominate the timing
+struct HelloWorldKernel {
+    template<typename Acc>
+    ALPAKA_FN_ACC void operator()(Acc const & acc, bool isGreeting) const {
+        using namespace alpaka;
+        uint32_t gridThreadIdx = idx::getIdx<Grid, Threads>(acc)[0];
+        uint32_t gridThreadExtent = workdiv::getWorkDiv<Grid, Threads>(acc)[0];
+        if (isGreeting && gridThreadIdx == 0)
+            printf("Hello, World from alpaka thread 0 of %u!\n", gridThreadExtent);
+    }
+};
+
+// Run the steps of helloWorld twice with the given strategy and print the profiles
+template<typename Acc>
+int profileStartup(InitStrategy strategy)
+{
+    using namespace alpaka;
+    using Dim = dim::Dim<Acc>;
+    using Idx = idx::Idx<Acc>;
+
+    StartupProfiler cold;
+    StartupProfiler warm;
+    for (uint32_t run = 0; run < 2; run++)
+    {
+        StartupProfiler & profiler = (run == 0) ? cold : warm;
+        profiler.restart();
+        if (strategy == InitStrategy::Eager)
+            RuntimeSpinUp<Acc>::run();
+        profiler.step("runtime spin-up");
+
+        auto const numDevices = pltf::getDevCount<pltf::Pltf<dev::Dev<Acc>>>();
+        profiler.step("platform enumeration");
+        auto const device = pltf::getDevByIdx<Acc>(0u);
+        profiler.step("getDevByIdx");
+        using Queue = queue::Queue<Acc, queue::Blocking>;
+        auto queue = Queue{device};
+        profiler.step("queue construction");
+
+        // One block per host thread, so that the runtime starts all its threads
+        using WorkDiv = workdiv::WorkDivMembers<Dim, Idx>;
+        auto workDiv = WorkDiv{static_cast<Idx>(getNumHostWorkers()), Idx{1}, Idx{1}};
+        auto taskRunKernel = kernel::createTaskKernel<Acc>(workDiv, HelloWorldKernel{}, run == 0);
+        profiler.step("kernel task creation");
+        queue::enqueue(queue, taskRunKernel);
+        alpaka::wait::wait(queue);
+        profiler.step("first enqueue and wait");
+        auto taskRunKernelAgain = kernel::createTaskKernel<Acc>(workDiv, HelloWorldKernel{}, false);
+        queue::enqueue(queue, taskRunKernelAgain);
+        alpaka::wait::wait(queue);
+        profiler.step("second enqueue and wait");
+        if (numDevices == 0)
+            return 1;
+    }
+    printStartupProfiles(acc::getAccName<Acc>() + ", " + getInitStrategyName(strategy) + " initialization", cold,
+        warm);
+    return 0;
+}
+
+// Profile both strategies in cold processes of their own
+template<typename Acc>
+bool profileBackEnd()
+{
+    bool isOk = runForked([]() { return profileStartup<Acc>(InitStrategy::Lazy); });
+    isOk &= runForked([]() { return profileStartup<Acc>(InitStrategy::Eager); });
+    return isOk;
+}
+
+int main() {
+    // For code brevity, all alpaka API is in namespace alpaka
+    using namespace alpaka;
+
+    // Define dimensionality and type of indices to be used in kernels
+    using Dim = dim::DimInt<1>;
+    using Idx = uint32_t;
+
+    // This process does not use any back-end itself, so that every child starts cold
+    bool isOk = true;
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuSerial<Dim, Idx>>();
+#endif
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuOmp2Blocks<Dim, Idx>>();
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuOmp2Threads<Dim, Idx>>();
+#endif
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuThreads<Dim, Idx>>();
+#endif
+#if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
+    isOk &= profileBackEnd<acc::AccCpuTbbBlocks<Dim, Idx>>();
+#endif
+
+    return isOk ? 0 : 1;
+}